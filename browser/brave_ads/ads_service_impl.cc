@@ -51,7 +51,6 @@
 #include "brave/components/brave_adaptive_captcha/buildflags/buildflags.h"
 #include "brave/components/brave_ads/browser/ads_p2a.h"
 #include "brave/components/brave_ads/browser/ads_storage_cleanup.h"
-#include "brave/components/brave_ads/browser/frequency_capping_helper.h"
 #include "brave/components/brave_ads/common/features.h"
 #include "brave/components/brave_ads/common/pref_names.h"
 #include "brave/components/brave_ads/common/switches.h"
@@ -319,6 +318,23 @@ void AdsServiceImpl::OnHtmlLoaded(const SessionID& tab_id,
   bat_ads_->OnHtmlLoaded(tab_id.id(), redirect_chain_as_strings, html);
 }
 
+void AdsServiceImpl::ShouldCaptureHtmlForConversion(
+    const std::vector<GURL>& redirect_chain,
+    ShouldCaptureHtmlForConversionCallback callback) {
+  if (!connected()) {
+    std::move(callback).Run(/* should_capture */ false);
+    return;
+  }
+
+  std::vector<std::string> redirect_chain_as_strings;
+  for (const auto& url : redirect_chain) {
+    redirect_chain_as_strings.push_back(url.spec());
+  }
+
+  bat_ads_->ShouldCaptureHtmlForConversion(redirect_chain_as_strings,
+                                           std::move(callback));
+}
+
 void AdsServiceImpl::OnTextLoaded(const SessionID& tab_id,
                                   const std::vector<GURL>& redirect_chain,
                                   const std::string& text) {
@@ -1955,24 +1971,6 @@ void AdsServiceImpl::CloseNotification(const std::string& uuid) {
   }
 }
 
-void AdsServiceImpl::RecordAdEvent(const std::string& ad_type,
-                                   const std::string& confirmation_type,
-                                   const double timestamp) const {
-  FrequencyCappingHelper::GetInstance()->RecordAdEvent(
-      ad_type, confirmation_type, timestamp);
-}
-
-std::vector<double> AdsServiceImpl::GetAdEvents(
-    const std::string& ad_type,
-    const std::string& confirmation_type) const {
-  return FrequencyCappingHelper::GetInstance()->GetAdEvents(ad_type,
-                                                            confirmation_type);
-}
-
-void AdsServiceImpl::ResetAdEvents() const {
-  return FrequencyCappingHelper::GetInstance()->ResetAdEvents();
-}
-
 void AdsServiceImpl::UrlRequest(ads::mojom::UrlRequestPtr url_request,
                                 ads::UrlRequestCallback callback) {
   auto resource_request = std::make_unique<network::ResourceRequest>();
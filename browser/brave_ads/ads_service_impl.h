@@ -127,6 +127,10 @@ class AdsServiceImpl : public AdsService,
                     const std::vector<GURL>& redirect_chain,
                     const std::string& html) override;
 
+  void ShouldCaptureHtmlForConversion(
+      const std::vector<GURL>& redirect_chain,
+      ShouldCaptureHtmlForConversionCallback callback) override;
+
   void OnTextLoaded(const SessionID& tab_id,
                     const std::vector<GURL>& redirect_chain,
                     const std::string& text) override;
@@ -361,16 +365,6 @@ class AdsServiceImpl : public AdsService,
 
   void CloseNotification(const std::string& uuid) override;
 
-  void RecordAdEvent(const std::string& type,
-                     const std::string& confirmation_type,
-                     const double timestamp) const override;
-
-  std::vector<double> GetAdEvents(
-      const std::string& ad_type,
-      const std::string& confirmation_type) const override;
-
-  void ResetAdEvents() const override;
-
   void UrlRequest(ads::mojom::UrlRequestPtr url_request,
                   ads::UrlRequestCallback callback) override;
 
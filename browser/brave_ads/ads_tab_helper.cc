@@ -66,10 +66,15 @@ void AdsTabHelper::RunIsolatedJavaScript(
     content::RenderFrameHost* render_frame_host) {
   DCHECK(render_frame_host);
 
-  dom_distiller::RunIsolatedJavaScript(
-      render_frame_host, "new XMLSerializer().serializeToString(document)",
-      base::BindOnce(&AdsTabHelper::OnJavaScriptHtmlResult,
-                     weak_factory_.GetWeakPtr()));
+  if (ads_service_) {
+    // Serializing the document is expensive, so only capture the HTML if it
+    // is needed to extract a verifiable conversion id
+    ads_service_->ShouldCaptureHtmlForConversion(
+        redirect_chain_,
+        base::BindOnce(&AdsTabHelper::OnShouldCaptureHtmlForConversion,
+                       weak_factory_.GetWeakPtr(),
+                       render_frame_host->GetGlobalId(), redirect_chain_));
+  }
 
   dom_distiller::RunIsolatedJavaScript(
       render_frame_host, "document?.body?.innerText",
@@ -77,7 +82,41 @@ void AdsTabHelper::RunIsolatedJavaScript(
                      weak_factory_.GetWeakPtr()));
 }
 
-void AdsTabHelper::OnJavaScriptHtmlResult(base::Value value) {
+void AdsTabHelper::OnShouldCaptureHtmlForConversion(
+    const content::GlobalRenderFrameHostId& render_frame_host_id,
+    const std::vector<GURL>& redirect_chain,
+    const bool should_capture) {
+  if (!ads_service_ || redirect_chain.empty()) {
+    return;
+  }
+
+  if (!should_capture) {
+    // The page content is not needed, so dedupe on the URL instead of the HTML
+    const uint32_t url_hash = base::FastHash(redirect_chain.back().spec());
+    if (url_hash == html_hash_) {
+      return;
+    }
+    html_hash_ = url_hash;
+
+    ads_service_->OnHtmlLoaded(tab_id_, redirect_chain, /* html */ "");
+    return;
+  }
+
+  content::RenderFrameHost* render_frame_host =
+      content::RenderFrameHost::FromID(render_frame_host_id);
+  if (!render_frame_host) {
+    return;
+  }
+
+  dom_distiller::RunIsolatedJavaScript(
+      render_frame_host, "new XMLSerializer().serializeToString(document)",
+      base::BindOnce(&AdsTabHelper::OnJavaScriptHtmlResult,
+                     weak_factory_.GetWeakPtr(), redirect_chain));
+}
+
+void AdsTabHelper::OnJavaScriptHtmlResult(
+    const std::vector<GURL>& redirect_chain,
+    base::Value value) {
   if (!ads_service_) {
     return;
   }
@@ -94,7 +133,7 @@ void AdsTabHelper::OnJavaScriptHtmlResult(base::Value value) {
   }
   html_hash_ = html_hash;
 
-  ads_service_->OnHtmlLoaded(tab_id_, redirect_chain_, html);
+  ads_service_->OnHtmlLoaded(tab_id_, redirect_chain, html);
 }
 
 void AdsTabHelper::OnJavaScriptTextResult(base::Value value) {
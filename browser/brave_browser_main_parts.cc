@@ -13,6 +13,7 @@
 #include "brave/common/brave_constants.h"
 #include "brave/common/pref_names.h"
 #include "brave/components/brave_sync/features.h"
+#include "brave/components/p3a/buildflags.h"
 #include "brave/components/speedreader/buildflags.h"
 #include "brave/components/tor/buildflags/buildflags.h"
 #include "brave/components/translate/core/common/brave_translate_features.h"
@@ -60,6 +61,11 @@
 #include "components/sync/driver/sync_user_settings.h"
 #endif
 
+#if BUILDFLAG(BRAVE_P3A_ENABLED)
+#include "brave/browser/brave_browser_process.h"
+#include "brave/components/p3a/brave_p3a_service.h"
+#endif
+
 #if BUILDFLAG(ETHEREUM_REMOTE_CLIENT_ENABLED) && BUILDFLAG(ENABLE_EXTENSIONS)
 #include "brave/browser/extensions/brave_component_loader.h"
 #include "chrome/browser/extensions/extension_service.h"
@@ -149,6 +155,10 @@ void BraveBrowserMainParts::PostBrowserStart() {
 }
 
 void BraveBrowserMainParts::PreShutdown() {
+#if BUILDFLAG(BRAVE_P3A_ENABLED)
+  // Local state is written for the last time during shutdown.
+  g_brave_browser_process->brave_p3a_service()->FlushPendingHistogramChanges();
+#endif
   content::BraveClearBrowsingData::ClearOnExit();
 }
 
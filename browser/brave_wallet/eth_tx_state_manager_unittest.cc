@@ -381,6 +381,93 @@ TEST_F(EthTxStateManagerUnitTest, GetTransactionsByStatus) {
   }
 }
 
+TEST_F(EthTxStateManagerUnitTest, CachedTxMetas) {
+  GetPrefs()->ClearPref(kBraveWalletTransactions);
+  EthTxStateManager tx_state_manager(GetPrefs(), rpc_controller_.get());
+
+  EthTxStateManager::TxMeta meta;
+  meta.id = "001";
+  meta.status = mojom::TransactionStatus::Submitted;
+  tx_state_manager.AddOrUpdateTx(meta);
+
+  // Fetched metas are copies, changing them does not touch the stored one.
+  auto meta_fetched = tx_state_manager.GetTx("001");
+  ASSERT_NE(meta_fetched, nullptr);
+  meta_fetched->status = mojom::TransactionStatus::Confirmed;
+  EXPECT_EQ(tx_state_manager
+                .GetTransactionsByStatus(mojom::TransactionStatus::Submitted,
+                                         absl::nullopt)
+                .size(),
+            1u);
+
+  // Updating the status moves the meta to its new status.
+  tx_state_manager.AddOrUpdateTx(*meta_fetched);
+  EXPECT_TRUE(tx_state_manager
+                  .GetTransactionsByStatus(mojom::TransactionStatus::Submitted,
+                                           absl::nullopt)
+                  .empty());
+  EXPECT_EQ(tx_state_manager
+                .GetTransactionsByStatus(mojom::TransactionStatus::Confirmed,
+                                         absl::nullopt)
+                .size(),
+            1u);
+
+  // Changes made to the pref by others are picked up.
+  GetPrefs()->ClearPref(kBraveWalletTransactions);
+  EXPECT_EQ(tx_state_manager.GetTx("001"), nullptr);
+  EXPECT_TRUE(
+      tx_state_manager.GetTransactionsByStatus(absl::nullopt, absl::nullopt)
+          .empty());
+}
+
+TEST_F(EthTxStateManagerUnitTest, CachedTxMetasByFrom) {
+  GetPrefs()->ClearPref(kBraveWalletTransactions);
+  EthTxStateManager tx_state_manager(GetPrefs(), rpc_controller_.get());
+  const EthAddress addr1 =
+      EthAddress::FromHex("0x3535353535353535353535353535353535353535");
+  const EthAddress addr2 =
+      EthAddress::FromHex("0x2f015c60e0be116b1f0cd534704db9c92118fb6a");
+
+  EthTxStateManager::TxMeta meta;
+  meta.id = "001";
+  meta.from = addr1;
+  meta.status = mojom::TransactionStatus::Submitted;
+  tx_state_manager.AddOrUpdateTx(meta);
+  meta.id = "002";
+  meta.status = mojom::TransactionStatus::Confirmed;
+  tx_state_manager.AddOrUpdateTx(meta);
+  meta.id = "003";
+  meta.from = addr2;
+  meta.status = mojom::TransactionStatus::Submitted;
+  tx_state_manager.AddOrUpdateTx(meta);
+
+  auto metas = tx_state_manager.GetTransactionsByStatus(absl::nullopt, addr1);
+  ASSERT_EQ(metas.size(), 2u);
+  EXPECT_EQ(metas[0]->id, "001");
+  EXPECT_EQ(metas[1]->id, "002");
+
+  metas = tx_state_manager.GetTransactionsByStatus(
+      mojom::TransactionStatus::Submitted, addr2);
+  ASSERT_EQ(metas.size(), 1u);
+  EXPECT_EQ(metas[0]->id, "003");
+
+  // Changing the from address moves the meta to its new address.
+  meta.from = addr1;
+  tx_state_manager.AddOrUpdateTx(meta);
+  EXPECT_TRUE(
+      tx_state_manager.GetTransactionsByStatus(absl::nullopt, addr2).empty());
+  metas = tx_state_manager.GetTransactionsByStatus(
+      mojom::TransactionStatus::Submitted, addr1);
+  ASSERT_EQ(metas.size(), 2u);
+  EXPECT_EQ(metas[0]->id, "001");
+  EXPECT_EQ(metas[1]->id, "003");
+
+  tx_state_manager.DeleteTx("001");
+  EXPECT_EQ(
+      tx_state_manager.GetTransactionsByStatus(absl::nullopt, addr1).size(),
+      2u);
+}
+
 TEST_F(EthTxStateManagerUnitTest, SwitchNetwork) {
   GetPrefs()->ClearPref(kBraveWalletTransactions);
   EthTxStateManager tx_state_manager(GetPrefs(), rpc_controller_.get());
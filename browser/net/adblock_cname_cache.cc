@@ -0,0 +1,117 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/net/adblock_cname_cache.h"
+
+#include <utility>
+
+#include "base/metrics/histogram_macros.h"
+#include "base/no_destructor.h"
+#include "base/time/tick_clock.h"
+#include "content/public/browser/browser_thread.h"
+
+namespace brave {
+
+namespace {
+
+void RecordLookupResult(AdblockCnameCache::LookupResult result) {
+  UMA_HISTOGRAM_ENUMERATION("Brave.ShieldsCNAMEBlocking.CacheLookup", result);
+}
+
+}  // namespace
+
+constexpr base::TimeDelta AdblockCnameCache::kTtl;
+constexpr base::TimeDelta AdblockCnameCache::kNegativeTtl;
+
+AdblockCnameCache::AdblockCnameCache(const base::TickClock* tick_clock)
+    : tick_clock_(tick_clock) {}
+
+AdblockCnameCache::~AdblockCnameCache() = default;
+
+// static
+AdblockCnameCache* AdblockCnameCache::GetInstance() {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  static base::NoDestructor<AdblockCnameCache> instance;
+  return instance.get();
+}
+
+bool AdblockCnameCache::Lookup(const std::string& key,
+                               ResultCallback callback) {
+  const auto entry_iter = entries_.find(key);
+  if (entry_iter != entries_.end()) {
+    if (entry_iter->second.expires_at > Now()) {
+      RecordLookupResult(LookupResult::kHit);
+      std::move(callback).Run(entry_iter->second.cname);
+      return false;
+    }
+
+    EraseEntry(entry_iter);
+  }
+
+  std::vector<ResultCallback>& callbacks = pending_callbacks_[key];
+  callbacks.push_back(std::move(callback));
+  if (callbacks.size() > 1) {
+    RecordLookupResult(LookupResult::kCoalesced);
+    return false;
+  }
+
+  RecordLookupResult(LookupResult::kMiss);
+  return true;
+}
+
+void AdblockCnameCache::OnResolved(const std::string& key,
+                                   absl::optional<std::string> cname,
+                                   bool cacheable) {
+  if (cacheable) {
+    const base::TimeTicks now = Now();
+    const auto entry_iter = entries_.find(key);
+    if (entry_iter != entries_.end())
+      EraseEntry(entry_iter);
+
+    EvictIfFull(now);
+    const base::TimeTicks expires_at = now + (cname ? kTtl : kNegativeTtl);
+    entries_[key] = {cname, expires_at};
+    expiry_index_.emplace(expires_at, key);
+  }
+
+  const auto pending_iter = pending_callbacks_.find(key);
+  if (pending_iter == pending_callbacks_.end())
+    return;
+
+  std::vector<ResultCallback> callbacks = std::move(pending_iter->second);
+  pending_callbacks_.erase(pending_iter);
+  for (auto& callback : callbacks)
+    std::move(callback).Run(cname);
+}
+
+void AdblockCnameCache::ClearForTesting() {
+  entries_.clear();
+  expiry_index_.clear();
+  pending_callbacks_.clear();
+}
+
+base::TimeTicks AdblockCnameCache::Now() const {
+  return tick_clock_ ? tick_clock_->NowTicks() : base::TimeTicks::Now();
+}
+
+void AdblockCnameCache::EraseEntry(
+    std::map<std::string, Entry>::iterator iter) {
+  expiry_index_.erase({iter->second.expires_at, iter->first});
+  entries_.erase(iter);
+}
+
+void AdblockCnameCache::EvictIfFull(base::TimeTicks now) {
+  if (entries_.size() < kMaxEntries)
+    return;
+
+  // Drop every expired entry, or failing that the one closest to expiring.
+  while (!expiry_index_.empty() &&
+         (expiry_index_.begin()->first <= now ||
+          entries_.size() >= kMaxEntries)) {
+    EraseEntry(entries_.find(expiry_index_.begin()->second));
+  }
+}
+
+}  // namespace brave
@@ -0,0 +1,89 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_BROWSER_NET_ADBLOCK_CNAME_CACHE_H_
+#define BRAVE_BROWSER_NET_ADBLOCK_CNAME_CACHE_H_
+
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/callback.h"
+#include "base/time/time.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
+
+namespace base {
+class TickClock;
+}  // namespace base
+
+namespace brave {
+
+// Caches the canonical names used for adblock CNAME uncloaking, so that
+// subresources from the same host share one DNS resolution. Lookups for a
+// host whose resolution is already in flight wait for that resolution rather
+// than starting another one. Failed resolutions are cached for a shorter time.
+class AdblockCnameCache {
+ public:
+  using ResultCallback =
+      base::OnceCallback<void(absl::optional<std::string> cname)>;
+
+  // The host resolver does not report record TTLs to the browser, so results
+  // are kept for a fixed time.
+  static constexpr base::TimeDelta kTtl = base::Minutes(1);
+  static constexpr base::TimeDelta kNegativeTtl = base::Seconds(10);
+  static constexpr size_t kMaxEntries = 1024;
+
+  // Values are recorded to UMA, do not reorder or remove.
+  enum class LookupResult {
+    kHit = 0,
+    kMiss = 1,
+    kCoalesced = 2,
+    kMaxValue = kCoalesced,
+  };
+
+  explicit AdblockCnameCache(const base::TickClock* tick_clock = nullptr);
+  ~AdblockCnameCache();
+
+  AdblockCnameCache(const AdblockCnameCache&) = delete;
+  AdblockCnameCache& operator=(const AdblockCnameCache&) = delete;
+
+  static AdblockCnameCache* GetInstance();
+
+  // Runs |callback| right away if a result for |key| is cached. Otherwise
+  // |callback| is run by the next OnResolved() for |key|. Returns true if the
+  // caller must start resolving |key| because no resolution is in flight.
+  bool Lookup(const std::string& key, ResultCallback callback);
+
+  // Runs all callbacks waiting on |key|. The result is cached only if
+  // |cacheable|, i.e. it came from an actual DNS resolution.
+  void OnResolved(const std::string& key,
+                  absl::optional<std::string> cname,
+                  bool cacheable);
+
+  void ClearForTesting();
+
+ private:
+  struct Entry {
+    absl::optional<std::string> cname;
+    base::TimeTicks expires_at;
+  };
+
+  base::TimeTicks Now() const;
+  void EraseEntry(std::map<std::string, Entry>::iterator iter);
+  void EvictIfFull(base::TimeTicks now);
+
+  const base::TickClock* tick_clock_;  // NOT OWNED
+  std::map<std::string, Entry> entries_;
+  // |entries_| keys ordered by expiry time, so that expired and then soonest
+  // to expire entries are evicted first.
+  std::set<std::pair<base::TimeTicks, std::string>> expiry_index_;
+  std::map<std::string, std::vector<ResultCallback>> pending_callbacks_;
+};
+
+}  // namespace brave
+
+#endif  // BRAVE_BROWSER_NET_ADBLOCK_CNAME_CACHE_H_
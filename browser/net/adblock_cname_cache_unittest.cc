@@ -0,0 +1,117 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/net/adblock_cname_cache.h"
+
+#include <string>
+#include <vector>
+
+#include "base/bind.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/test/metrics/histogram_tester.h"
+#include "base/test/simple_test_tick_clock.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace brave {
+
+class AdblockCnameCacheTest : public testing::Test {
+ protected:
+  AdblockCnameCacheTest() : cache_(&tick_clock_) {}
+
+  AdblockCnameCache::ResultCallback RecordResult() {
+    return base::BindOnce(
+        [](std::vector<absl::optional<std::string>>* results,
+           absl::optional<std::string> cname) { results->push_back(cname); },
+        &results_);
+  }
+
+  base::SimpleTestTickClock tick_clock_;
+  AdblockCnameCache cache_;
+  std::vector<absl::optional<std::string>> results_;
+};
+
+TEST_F(AdblockCnameCacheTest, CoalescesInFlightLookups) {
+  base::HistogramTester histogram_tester;
+
+  EXPECT_TRUE(cache_.Lookup("a.com", RecordResult()));
+  EXPECT_FALSE(cache_.Lookup("a.com", RecordResult()));
+  EXPECT_TRUE(results_.empty());
+
+  cache_.OnResolved("a.com", std::string("tracker.com"), true);
+
+  EXPECT_EQ(2u, results_.size());
+  EXPECT_EQ("tracker.com", results_[0]);
+  EXPECT_EQ("tracker.com", results_[1]);
+  histogram_tester.ExpectBucketCount("Brave.ShieldsCNAMEBlocking.CacheLookup",
+                                     AdblockCnameCache::LookupResult::kMiss, 1);
+  histogram_tester.ExpectBucketCount(
+      "Brave.ShieldsCNAMEBlocking.CacheLookup",
+      AdblockCnameCache::LookupResult::kCoalesced, 1);
+}
+
+TEST_F(AdblockCnameCacheTest, CachesResultsUntilExpired) {
+  EXPECT_TRUE(cache_.Lookup("a.com", RecordResult()));
+  cache_.OnResolved("a.com", std::string("tracker.com"), true);
+
+  tick_clock_.Advance(AdblockCnameCache::kTtl - base::Seconds(1));
+  EXPECT_FALSE(cache_.Lookup("a.com", RecordResult()));
+  ASSERT_EQ(2u, results_.size());
+  EXPECT_EQ("tracker.com", results_[1]);
+
+  tick_clock_.Advance(base::Seconds(1));
+  EXPECT_TRUE(cache_.Lookup("a.com", RecordResult()));
+  EXPECT_EQ(2u, results_.size());
+}
+
+TEST_F(AdblockCnameCacheTest, CachesFailuresForShorterTime) {
+  EXPECT_TRUE(cache_.Lookup("a.com", RecordResult()));
+  cache_.OnResolved("a.com", absl::nullopt, true);
+
+  EXPECT_FALSE(cache_.Lookup("a.com", RecordResult()));
+  ASSERT_EQ(2u, results_.size());
+  EXPECT_FALSE(results_[1]);
+
+  tick_clock_.Advance(AdblockCnameCache::kNegativeTtl);
+  EXPECT_TRUE(cache_.Lookup("a.com", RecordResult()));
+}
+
+TEST_F(AdblockCnameCacheTest, DoesNotCacheUncacheableResults) {
+  EXPECT_TRUE(cache_.Lookup("a.com", RecordResult()));
+  cache_.OnResolved("a.com", absl::nullopt, false);
+  EXPECT_EQ(1u, results_.size());
+
+  EXPECT_TRUE(cache_.Lookup("a.com", RecordResult()));
+}
+
+TEST_F(AdblockCnameCacheTest, KeysAreIndependent) {
+  EXPECT_TRUE(cache_.Lookup("a.com", RecordResult()));
+  EXPECT_TRUE(cache_.Lookup("b.com", RecordResult()));
+
+  cache_.OnResolved("b.com", std::string("tracker.com"), true);
+
+  ASSERT_EQ(1u, results_.size());
+  EXPECT_EQ("tracker.com", results_[0]);
+}
+
+TEST_F(AdblockCnameCacheTest, EvictsSoonestToExpireWhenFull) {
+  // The first entry sorts last by key but expires first.
+  EXPECT_TRUE(cache_.Lookup("z.com", RecordResult()));
+  cache_.OnResolved("z.com", std::string("tracker.com"), true);
+  for (size_t i = 1; i < AdblockCnameCache::kMaxEntries; i++) {
+    tick_clock_.Advance(base::Milliseconds(1));
+    const std::string key = "a" + base::NumberToString(i) + ".com";
+    EXPECT_TRUE(cache_.Lookup(key, RecordResult()));
+    cache_.OnResolved(key, std::string("tracker.com"), true);
+  }
+
+  tick_clock_.Advance(base::Milliseconds(1));
+  EXPECT_TRUE(cache_.Lookup("b.com", RecordResult()));
+  cache_.OnResolved("b.com", std::string("tracker.com"), true);
+
+  EXPECT_FALSE(cache_.Lookup("a1.com", RecordResult()));
+  EXPECT_TRUE(cache_.Lookup("z.com", RecordResult()));
+}
+
+}  // namespace brave
@@ -13,9 +13,12 @@
 #include "base/base64url.h"
 #include "base/feature_list.h"
 #include "base/metrics/histogram_macros.h"
+#include "base/no_destructor.h"
+#include "base/strings/strcat.h"
 #include "base/strings/string_util.h"
 #include "brave/browser/brave_browser_process.h"
 #include "brave/browser/brave_shields/brave_shields_web_contents_observer.h"
+#include "brave/browser/net/adblock_cname_cache.h"
 #include "brave/browser/net/url_context.h"
 #include "brave/common/network_constants.h"
 #include "brave/common/url_constants.h"
@@ -30,6 +33,7 @@
 #include "components/prefs/pref_service.h"
 #include "components/proxy_config/pref_proxy_config_tracker.h"
 #include "content/public/browser/browser_context.h"
+#include "content/public/browser/browser_task_traits.h"
 #include "content/public/browser/browser_thread.h"
 #include "content/public/browser/render_frame_host.h"
 #include "content/public/browser/storage_partition.h"
@@ -78,21 +82,19 @@ void UseCnameResult(scoped_refptr<base::SequencedTaskRunner> task_runner,
                     EngineFlags previous_result,
                     absl::optional<std::string> cname);
 
+// Resolves the canonical name of a request's host and hands the result to
+// the AdblockCnameCache, which runs every lookup waiting on that host.
 class AdblockCnameResolveHostClient : public network::mojom::ResolveHostClient {
  private:
   mojo::Receiver<network::mojom::ResolveHostClient> receiver_{this};
-  base::OnceCallback<void(absl::optional<std::string>)> cb_;
+  std::string cache_key_;
   base::TimeTicks start_time_;
 
  public:
-  AdblockCnameResolveHostClient(
-      const ResponseCallback& next_callback,
-      scoped_refptr<base::SequencedTaskRunner> task_runner,
-      std::shared_ptr<BraveRequestInfo> ctx,
-      EngineFlags previous_result) {
+  AdblockCnameResolveHostClient(const std::string& cache_key,
+                                std::shared_ptr<BraveRequestInfo> ctx)
+      : cache_key_(cache_key) {
     DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
-    cb_ = base::BindOnce(&UseCnameResult, task_runner, std::move(next_callback),
-                         ctx, previous_result);
 
     const auto network_isolation_key = ctx->network_isolation_key;
 
@@ -119,9 +121,10 @@ class AdblockCnameResolveHostClient : public network::mojom::ResolveHostClient {
       auto* web_contents =
           content::WebContents::FromFrameTreeNodeId(ctx->frame_tree_node_id);
       if (!web_contents) {
-        start_time_ = base::TimeTicks::Now();
-        this->OnComplete(net::ERR_FAILED, net::ResolveErrorInfo(),
-                         absl::nullopt);
+        // Nothing was resolved, so the result must not be cached.
+        AdblockCnameCache::GetInstance()->OnResolved(cache_key_, absl::nullopt,
+                                                     /*cacheable=*/false);
+        delete this;
         return;
       }
 
@@ -136,9 +139,8 @@ class AdblockCnameResolveHostClient : public network::mojom::ResolveHostClient {
     }
 
     receiver_.set_disconnect_handler(
-        base::BindOnce(&AdblockCnameResolveHostClient::OnComplete,
-                       base::Unretained(this), net::ERR_NAME_NOT_RESOLVED,
-                       net::ResolveErrorInfo(net::ERR_FAILED), absl::nullopt));
+        base::BindOnce(&AdblockCnameResolveHostClient::OnDisconnect,
+                       base::Unretained(this)));
   }
 
   void OnComplete(
@@ -147,13 +149,20 @@ class AdblockCnameResolveHostClient : public network::mojom::ResolveHostClient {
       const absl::optional<net::AddressList>& resolved_addresses) override {
     UMA_HISTOGRAM_TIMES("Brave.ShieldsCNAMEBlocking.TotalResolutionTime",
                         base::TimeTicks::Now() - start_time_);
+    absl::optional<std::string> cname;
     if (result == net::OK && resolved_addresses) {
       DCHECK(resolved_addresses.has_value() && !resolved_addresses->empty());
-      std::move(cb_).Run(
-          absl::optional<std::string>(resolved_addresses->GetCanonicalName()));
-    } else {
-      std::move(cb_).Run(absl::nullopt);
+      cname = resolved_addresses->GetCanonicalName();
     }
+    AdblockCnameCache::GetInstance()->OnResolved(cache_key_, std::move(cname),
+                                                 /*cacheable=*/true);
+
+    delete this;
+  }
+
+  void OnDisconnect() {
+    AdblockCnameCache::GetInstance()->OnResolved(cache_key_, absl::nullopt,
+                                                 /*cacheable=*/false);
 
     delete this;
   }
@@ -238,6 +247,20 @@ EngineFlags ShouldBlockRequestOnTaskRunner(
   return previous_result;
 }
 
+// Requests are resolved in the profile's network context with the request's
+// network isolation key, so results are only shared within that partition.
+// Transient keys have no cache key string; their debug string includes the
+// opaque origin's nonce, so those results are never shared either.
+std::string GetCnameCacheKey(const BraveRequestInfo& ctx) {
+  const absl::optional<std::string> isolation_key =
+      ctx.network_isolation_key.ToCacheKeyString();
+  return base::StrCat(
+      {ctx.browser_context ? ctx.browser_context->UniqueId() : "", " ",
+       isolation_key ? *isolation_key
+                     : ctx.network_isolation_key.ToDebugString(),
+       " ", ctx.request_url.host()});
+}
+
 void OnShouldBlockRequestResult(
     bool then_check_uncloaked,
     scoped_refptr<base::SequencedTaskRunner> task_runner,
@@ -249,14 +272,81 @@ void OnShouldBlockRequestResult(
     brave_shields::BraveShieldsWebContentsObserver::DispatchBlockedEvent(
         ctx->request_url, ctx->frame_tree_node_id, brave_shields::kAds);
   } else if (then_check_uncloaked) {
-    // This will be deleted by `AdblockCnameResolveHostClient::OnComplete`.
-    new AdblockCnameResolveHostClient(std::move(next_callback), task_runner,
-                                      ctx, result);
+    const std::string cache_key = GetCnameCacheKey(*ctx);
+    if (AdblockCnameCache::GetInstance()->Lookup(
+            cache_key, base::BindOnce(&UseCnameResult, task_runner,
+                                      next_callback, ctx, result))) {
+      // This will delete itself once the resolution completes.
+      new AdblockCnameResolveHostClient(cache_key, ctx);
+    }
     return;
   }
   next_callback.Run();
 }
 
+// A request waiting for its primary adblock engine query. Requests issued
+// within the same UI thread task are queried together in a single task on the
+// adblock task runner instead of one post and reply per request.
+struct PendingAdBlockCheck {
+  std::shared_ptr<BraveRequestInfo> ctx;
+  ResponseCallback next_callback;
+  bool should_check_uncloaked = false;
+};
+
+std::vector<PendingAdBlockCheck>& GetPendingAdBlockChecks() {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  static base::NoDestructor<std::vector<PendingAdBlockCheck>> pending_checks;
+  return *pending_checks;
+}
+
+std::vector<EngineFlags> ShouldBlockRequestsOnTaskRunner(
+    std::vector<std::shared_ptr<BraveRequestInfo>> ctxs) {
+  std::vector<EngineFlags> results;
+  results.reserve(ctxs.size());
+  for (const auto& ctx : ctxs) {
+    results.push_back(
+        ShouldBlockRequestOnTaskRunner(ctx, EngineFlags(), absl::nullopt));
+  }
+  return results;
+}
+
+void OnShouldBlockRequestsResult(
+    scoped_refptr<base::SequencedTaskRunner> task_runner,
+    std::vector<PendingAdBlockCheck> checks,
+    std::vector<EngineFlags> results) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  DCHECK_EQ(checks.size(), results.size());
+  for (size_t i = 0; i < checks.size(); ++i) {
+    OnShouldBlockRequestResult(checks[i].should_check_uncloaked, task_runner,
+                               checks[i].next_callback, checks[i].ctx,
+                               results[i]);
+  }
+}
+
+void FlushPendingAdBlockChecks() {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  std::vector<PendingAdBlockCheck> checks;
+  checks.swap(GetPendingAdBlockChecks());
+  if (checks.empty())
+    return;
+
+  std::vector<std::shared_ptr<BraveRequestInfo>> ctxs;
+  ctxs.reserve(checks.size());
+  for (const auto& check : checks)
+    ctxs.push_back(check.ctx);
+
+  UMA_HISTOGRAM_COUNTS_1000("Brave.Adblock.ShouldBlockRequestBatchSize",
+                            checks.size());
+
+  scoped_refptr<base::SequencedTaskRunner> task_runner =
+      g_brave_browser_process->ad_block_service()->GetTaskRunner();
+  task_runner->PostTaskAndReplyWithResult(
+      FROM_HERE,
+      base::BindOnce(&ShouldBlockRequestsOnTaskRunner, std::move(ctxs)),
+      base::BindOnce(&OnShouldBlockRequestsResult, task_runner,
+                     std::move(checks)));
+}
+
 void UseCnameResult(scoped_refptr<base::SequencedTaskRunner> task_runner,
                     const ResponseCallback& next_callback,
                     std::shared_ptr<BraveRequestInfo> ctx,
@@ -342,9 +432,6 @@ void OnBeforeURLRequestAdBlockTP(const ResponseCallback& next_callback,
   DCHECK(!ctx->request_url.is_empty());
   DCHECK(!ctx->initiator_url.is_empty());
 
-  scoped_refptr<base::SequencedTaskRunner> task_runner =
-      g_brave_browser_process->ad_block_service()->GetTaskRunner();
-
   SecureDnsConfig secure_dns_config =
       SystemNetworkContextManager::GetStubResolverConfigReader()
           ->GetSecureDnsConfiguration(false);
@@ -373,12 +460,12 @@ void OnBeforeURLRequestAdBlockTP(const ResponseCallback& next_callback,
     should_check_uncloaked = false;
   }
 
-  task_runner->PostTaskAndReplyWithResult(
-      FROM_HERE,
-      base::BindOnce(&ShouldBlockRequestOnTaskRunner, ctx, EngineFlags(),
-                     absl::nullopt),
-      base::BindOnce(&OnShouldBlockRequestResult, should_check_uncloaked,
-                     task_runner, next_callback, ctx));
+  std::vector<PendingAdBlockCheck>& pending_checks = GetPendingAdBlockChecks();
+  if (pending_checks.empty()) {
+    content::GetUIThreadTaskRunner({})->PostTask(
+        FROM_HERE, base::BindOnce(&FlushPendingAdBlockChecks));
+  }
+  pending_checks.push_back({ctx, next_callback, should_check_uncloaked});
 }
 
 int OnBeforeURLRequest_AdBlockTPPreWork(const ResponseCallback& next_callback,
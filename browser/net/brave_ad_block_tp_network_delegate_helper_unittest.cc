@@ -8,8 +8,10 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "base/path_service.h"
+#include "base/test/metrics/histogram_tester.h"
 #include "base/threading/thread_task_runner_handle.h"
 #include "brave/browser/brave_browser_process.h"
 #include "brave/browser/net/url_context.h"
@@ -221,6 +223,37 @@ TEST_F(BraveAdBlockTPNetworkDelegateHelperTest, SimpleBlocking) {
   EXPECT_EQ(0ULL, host_resolver_->num_resolve());
 }
 
+TEST_F(BraveAdBlockTPNetworkDelegateHelperTest, BatchedRequests) {
+  ResetAdblockInstance(g_brave_browser_process->ad_block_service(),
+                       "||brave.com/test.txt", "", false);
+
+  const GURL blocked_url("https://brave.com/test.txt");
+  const GURL allowed_url("https://brave.com/allowed.txt");
+  std::vector<std::shared_ptr<brave::BraveRequestInfo>> request_infos;
+  for (const GURL& url : {blocked_url, allowed_url, blocked_url}) {
+    auto request_info = std::make_shared<brave::BraveRequestInfo>(url);
+    request_info->request_identifier = request_infos.size() + 1;
+    request_info->resource_type = blink::mojom::ResourceType::kScript;
+    request_info->initiator_url = GURL("https://brave.com");
+    request_infos.push_back(request_info);
+  }
+
+  // All requests are issued before the task environment runs, so they are
+  // checked against the engine in a single batch.
+  base::HistogramTester histogram_tester;
+  for (const auto& request_info : request_infos) {
+    EXPECT_EQ(net::ERR_IO_PENDING, OnBeforeURLRequest_AdBlockTPPreWork(
+                                       base::DoNothing(), request_info));
+  }
+  task_environment_.RunUntilIdle();
+
+  histogram_tester.ExpectUniqueSample(
+      "Brave.Adblock.ShouldBlockRequestBatchSize", 3, 1);
+  EXPECT_EQ(request_infos[0]->blocked_by, brave::kAdBlocked);
+  EXPECT_EQ(request_infos[1]->blocked_by, brave::kNotBlocked);
+  EXPECT_EQ(request_infos[2]->blocked_by, brave::kAdBlocked);
+}
+
 TEST_F(BraveAdBlockTPNetworkDelegateHelperTest, RedirectUrl) {
   ResetAdblockInstance(
       g_brave_browser_process->ad_block_service(),
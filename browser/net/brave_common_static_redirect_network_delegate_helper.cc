@@ -7,9 +7,12 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
+#include "base/no_destructor.h"
 #include "base/strings/string_split.h"
 #include "base/strings/string_util.h"
+#include "brave/browser/net/static_redirect_table.h"
 #include "brave/common/network_constants.h"
 #include "extensions/common/url_pattern.h"
 #include "net/base/net_errors.h"
@@ -42,6 +45,29 @@ bool RewriteBugReportingURL(const GURL& request_url, GURL* new_url) {
   return true;
 }
 
+enum class CommonStaticRedirectRule {
+  kChromeCast,
+  kClients4,
+  kBugsChromium,
+};
+
+constexpr int kHttpAndHttps =
+    URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS;
+
+// Rules are matched in order and the first one which applies wins.
+const StaticRedirectTable& GetCommonStaticRedirectTable() {
+  static const base::NoDestructor<StaticRedirectTable> table(
+      std::vector<StaticRedirectTable::Rule>{
+          {static_cast<int>(CommonStaticRedirectRule::kChromeCast),
+           kHttpAndHttps, kChromeCastPrefix},
+          {static_cast<int>(CommonStaticRedirectRule::kClients4),
+           kHttpAndHttps, kClients4Prefix, /*match_host_only=*/true},
+          {static_cast<int>(CommonStaticRedirectRule::kBugsChromium),
+           kHttpAndHttps, "*://bugs.chromium.org/p/chromium/issues/entry?*"},
+      });
+  return *table;
+}
+
 }  // namespace
 
 int OnBeforeURLRequest_CommonStaticRedirectWork(
@@ -62,31 +88,29 @@ int OnBeforeURLRequest_CommonStaticRedirectWorkForGURL(
   DCHECK(new_url);
 
   GURL::Replacements replacements;
-  static URLPattern chromecast_pattern(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS, kChromeCastPrefix);
-  static URLPattern clients4_pattern(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS, kClients4Prefix);
-  static URLPattern bugsChromium_pattern(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS,
-      "*://bugs.chromium.org/p/chromium/issues/entry?*");
-
-  if (chromecast_pattern.MatchesURL(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr(kBraveRedirectorProxy);
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (clients4_pattern.MatchesHost(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr(kBraveClients4Proxy);
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (bugsChromium_pattern.MatchesURL(request_url)) {
-    if (RewriteBugReportingURL(request_url, new_url))
-      return net::OK;
+  for (const int rule_id : GetCommonStaticRedirectTable().GetMatchingRuleIds(
+           request_url)) {
+    switch (static_cast<CommonStaticRedirectRule>(rule_id)) {
+      case CommonStaticRedirectRule::kChromeCast: {
+        replacements.SetSchemeStr("https");
+        replacements.SetHostStr(kBraveRedirectorProxy);
+        *new_url = request_url.ReplaceComponents(replacements);
+        return net::OK;
+      }
+
+      case CommonStaticRedirectRule::kClients4: {
+        replacements.SetSchemeStr("https");
+        replacements.SetHostStr(kBraveClients4Proxy);
+        *new_url = request_url.ReplaceComponents(replacements);
+        return net::OK;
+      }
+
+      case CommonStaticRedirectRule::kBugsChromium: {
+        if (RewriteBugReportingURL(request_url, new_url))
+          return net::OK;
+        break;
+      }
+    }
   }
 
   return net::OK;
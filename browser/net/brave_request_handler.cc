@@ -11,6 +11,7 @@
 #include "base/containers/contains.h"
 #include "base/feature_list.h"
 #include "base/task/post_task.h"
+#include "base/trace_event/trace_event.h"
 #include "brave/browser/net/brave_ad_block_csp_network_delegate_helper.h"
 #include "brave/browser/net/brave_ad_block_tp_network_delegate_helper.h"
 #include "brave/browser/net/brave_common_static_redirect_network_delegate_helper.h"
@@ -219,17 +220,25 @@ void BraveRequestHandler::RunNextCallback(
     return;
   }
 
+  TRACE_EVENT1("net", "BraveRequestHandler::RunNextCallback", "event_type",
+               static_cast<int>(ctx->event_type));
+
+  // Every step run in this pass resumes the pipeline the same way, so the
+  // continuation is bound once here rather than once per step. Only steps
+  // that return PENDING keep a reference to it.
+  const brave::ResponseCallback next_callback = base::BindRepeating(
+      &BraveRequestHandler::RunNextCallback, weak_factory_.GetWeakPtr(), ctx);
+
   // Continue processing callbacks until we hit one that returns PENDING
   int rv = net::OK;
 
   if (ctx->event_type == brave::kOnBeforeRequest) {
     while (before_url_request_callbacks_.size() !=
            ctx->next_url_request_index) {
-      brave::OnBeforeURLRequestCallback callback =
+      TRACE_EVENT1("net", "BraveRequestHandler::OnBeforeURLRequestStep",
+                   "index", ctx->next_url_request_index);
+      const brave::OnBeforeURLRequestCallback& callback =
           before_url_request_callbacks_[ctx->next_url_request_index++];
-      brave::ResponseCallback next_callback =
-          base::BindRepeating(&BraveRequestHandler::RunNextCallback,
-                              weak_factory_.GetWeakPtr(), ctx);
       rv = callback.Run(next_callback, ctx);
       if (rv == net::ERR_IO_PENDING) {
         return;
@@ -241,11 +250,10 @@ void BraveRequestHandler::RunNextCallback(
   } else if (ctx->event_type == brave::kOnBeforeStartTransaction) {
     while (before_start_transaction_callbacks_.size() !=
            ctx->next_url_request_index) {
-      brave::OnBeforeStartTransactionCallback callback =
+      TRACE_EVENT1("net", "BraveRequestHandler::OnBeforeStartTransactionStep",
+                   "index", ctx->next_url_request_index);
+      const brave::OnBeforeStartTransactionCallback& callback =
           before_start_transaction_callbacks_[ctx->next_url_request_index++];
-      brave::ResponseCallback next_callback =
-          base::BindRepeating(&BraveRequestHandler::RunNextCallback,
-                              weak_factory_.GetWeakPtr(), ctx);
       rv = callback.Run(ctx->headers, next_callback, ctx);
       if (rv == net::ERR_IO_PENDING) {
         return;
@@ -256,11 +264,10 @@ void BraveRequestHandler::RunNextCallback(
     }
   } else if (ctx->event_type == brave::kOnHeadersReceived) {
     while (headers_received_callbacks_.size() != ctx->next_url_request_index) {
-      brave::OnHeadersReceivedCallback callback =
+      TRACE_EVENT1("net", "BraveRequestHandler::OnHeadersReceivedStep",
+                   "index", ctx->next_url_request_index);
+      const brave::OnHeadersReceivedCallback& callback =
           headers_received_callbacks_[ctx->next_url_request_index++];
-      brave::ResponseCallback next_callback =
-          base::BindRepeating(&BraveRequestHandler::RunNextCallback,
-                              weak_factory_.GetWeakPtr(), ctx);
       rv = callback.Run(ctx->original_response_headers,
                         ctx->override_response_headers,
                         ctx->allowed_unsafe_redirect_url, next_callback, ctx);
@@ -10,7 +10,9 @@
 #include <string>
 #include <vector>
 
+#include "base/no_destructor.h"
 #include "base/strings/string_piece_forward.h"
+#include "brave/browser/net/static_redirect_table.h"
 #include "brave/common/network_constants.h"
 #include "extensions/common/url_pattern.h"
 #include "net/base/net_errors.h"
@@ -29,6 +31,60 @@ base::StringPiece GetSafeBrowsingEndpoint() {
   return SAFEBROWSING_ENDPOINT;
 }
 
+enum class StaticRedirectRule {
+  kGeo,
+  kSafeBrowsing,
+  kSafeBrowsingFileCheck,
+  kSafeBrowsingCrxList,
+  kCRXDownload,
+  kAutofill,
+  kCRLSet,
+  kWidevine,
+  kRedirector,
+};
+
+constexpr int kHttpAndHttps =
+    URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS;
+
+// Rules are matched in order and the first one which applies wins.
+const StaticRedirectTable& GetStaticRedirectTable() {
+  static const base::NoDestructor<StaticRedirectTable> table(
+      std::vector<StaticRedirectTable::Rule>{
+          {static_cast<int>(StaticRedirectRule::kGeo),
+           URLPattern::SCHEME_HTTPS, kGeoLocationsPattern},
+          {static_cast<int>(StaticRedirectRule::kSafeBrowsing),
+           URLPattern::SCHEME_HTTPS, kSafeBrowsingPrefix,
+           /*match_host_only=*/true},
+          {static_cast<int>(StaticRedirectRule::kSafeBrowsingFileCheck),
+           URLPattern::SCHEME_HTTPS, kSafeBrowsingFileCheckPrefix,
+           /*match_host_only=*/true},
+          {static_cast<int>(StaticRedirectRule::kSafeBrowsingCrxList),
+           URLPattern::SCHEME_HTTPS, kSafeBrowsingCrxListPrefix,
+           /*match_host_only=*/true},
+          {static_cast<int>(StaticRedirectRule::kCRXDownload), kHttpAndHttps,
+           kCRXDownloadPrefix},
+          {static_cast<int>(StaticRedirectRule::kAutofill),
+           URLPattern::SCHEME_HTTPS, kAutofillPrefix},
+          {static_cast<int>(StaticRedirectRule::kCRLSet), kHttpAndHttps,
+           kCRLSetPrefix1},
+          {static_cast<int>(StaticRedirectRule::kCRLSet), kHttpAndHttps,
+           kCRLSetPrefix2},
+          {static_cast<int>(StaticRedirectRule::kCRLSet), kHttpAndHttps,
+           kCRLSetPrefix3},
+          {static_cast<int>(StaticRedirectRule::kCRLSet), kHttpAndHttps,
+           kCRLSetPrefix4},
+          {static_cast<int>(StaticRedirectRule::kWidevine), kHttpAndHttps,
+           kWidevineGvt1Prefix},
+          {static_cast<int>(StaticRedirectRule::kWidevine), kHttpAndHttps,
+           kWidevineGoogleDlPrefix},
+          {static_cast<int>(StaticRedirectRule::kRedirector), kHttpAndHttps,
+           "*://*.gvt1.com/*"},
+          {static_cast<int>(StaticRedirectRule::kRedirector), kHttpAndHttps,
+           "*://dl.google.com/*"},
+      });
+  return *table;
+}
+
 }  // namespace
 
 void SetSafeBrowsingEndpointForTesting(bool testing) {
@@ -51,124 +107,73 @@ int OnBeforeURLRequest_StaticRedirectWorkForGURL(
     const GURL& request_url,
     GURL* new_url) {
   GURL::Replacements replacements;
-  static URLPattern geo_pattern(URLPattern::SCHEME_HTTPS, kGeoLocationsPattern);
-  static URLPattern safeBrowsing_pattern(URLPattern::SCHEME_HTTPS,
-                                         kSafeBrowsingPrefix);
-  static URLPattern safebrowsingfilecheck_pattern(URLPattern::SCHEME_HTTPS,
-                                                  kSafeBrowsingFileCheckPrefix);
-  static URLPattern safebrowsingcrxlist_pattern(URLPattern::SCHEME_HTTPS,
-                                                kSafeBrowsingCrxListPrefix);
-
-  // To-Do (@jumde) - Update the naming for the variables below
-  // https://github.com/brave/brave-browser/issues/10314
-  static URLPattern crlSet_pattern1(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS, kCRLSetPrefix1);
-  static URLPattern crlSet_pattern2(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS, kCRLSetPrefix2);
-  static URLPattern crlSet_pattern3(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS, kCRLSetPrefix3);
-  static URLPattern crlSet_pattern4(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS, kCRLSetPrefix4);
-  static URLPattern crxDownload_pattern(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS, kCRXDownloadPrefix);
-  static URLPattern autofill_pattern(
-      URLPattern::SCHEME_HTTPS, kAutofillPrefix);
-  static URLPattern gvt1_pattern(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS, "*://*.gvt1.com/*");
-  static URLPattern googleDl_pattern(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS,
-      "*://dl.google.com/*");
-
-  static URLPattern widevine_gvt1_pattern(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS,
-      kWidevineGvt1Prefix);
-  static URLPattern widevine_google_dl_pattern(
-      URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS,
-      kWidevineGoogleDlPrefix);
-
-  if (geo_pattern.MatchesURL(request_url)) {
-    *new_url = GURL(GOOGLEAPIS_ENDPOINT GOOGLEAPIS_API_KEY);
-    return net::OK;
-  }
-
-  auto safebrowsing_endpoint = GetSafeBrowsingEndpoint();
-  if (!safebrowsing_endpoint.empty() &&
-      safeBrowsing_pattern.MatchesHost(request_url)) {
-    replacements.SetHostStr(safebrowsing_endpoint);
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (!safebrowsing_endpoint.empty() &&
-      safebrowsingfilecheck_pattern.MatchesHost(request_url)) {
-    replacements.SetHostStr(kBraveSafeBrowsingSslProxy);
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (!safebrowsing_endpoint.empty() &&
-      safebrowsingcrxlist_pattern.MatchesHost(request_url)) {
-    replacements.SetHostStr(kBraveSafeBrowsing2Proxy);
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (crxDownload_pattern.MatchesURL(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr("crxdownload.brave.com");
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (autofill_pattern.MatchesURL(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr(kBraveStaticProxy);
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (crlSet_pattern1.MatchesURL(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr("crlsets.brave.com");
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (crlSet_pattern2.MatchesURL(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr("crlsets.brave.com");
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (crlSet_pattern3.MatchesURL(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr("crlsets.brave.com");
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (crlSet_pattern4.MatchesURL(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr("crlsets.brave.com");
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (gvt1_pattern.MatchesURL(request_url) &&
-      !widevine_gvt1_pattern.MatchesURL(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr(kBraveRedirectorProxy);
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
-  }
-
-  if (googleDl_pattern.MatchesURL(request_url) &&
-      !widevine_google_dl_pattern.MatchesURL(request_url)) {
-    replacements.SetSchemeStr("https");
-    replacements.SetHostStr(kBraveRedirectorProxy);
-    *new_url = request_url.ReplaceComponents(replacements);
-    return net::OK;
+  for (const int rule_id : GetStaticRedirectTable().GetMatchingRuleIds(
+           request_url)) {
+    switch (static_cast<StaticRedirectRule>(rule_id)) {
+      case StaticRedirectRule::kGeo: {
+        *new_url = GURL(GOOGLEAPIS_ENDPOINT GOOGLEAPIS_API_KEY);
+        return net::OK;
+      }
+
+      case StaticRedirectRule::kSafeBrowsing: {
+        const base::StringPiece safebrowsing_endpoint =
+            GetSafeBrowsingEndpoint();
+        if (safebrowsing_endpoint.empty())
+          break;
+        replacements.SetHostStr(safebrowsing_endpoint);
+        *new_url = request_url.ReplaceComponents(replacements);
+        return net::OK;
+      }
+
+      case StaticRedirectRule::kSafeBrowsingFileCheck: {
+        if (GetSafeBrowsingEndpoint().empty())
+          break;
+        replacements.SetHostStr(kBraveSafeBrowsingSslProxy);
+        *new_url = request_url.ReplaceComponents(replacements);
+        return net::OK;
+      }
+
+      case StaticRedirectRule::kSafeBrowsingCrxList: {
+        if (GetSafeBrowsingEndpoint().empty())
+          break;
+        replacements.SetHostStr(kBraveSafeBrowsing2Proxy);
+        *new_url = request_url.ReplaceComponents(replacements);
+        return net::OK;
+      }
+
+      case StaticRedirectRule::kCRXDownload: {
+        replacements.SetSchemeStr("https");
+        replacements.SetHostStr("crxdownload.brave.com");
+        *new_url = request_url.ReplaceComponents(replacements);
+        return net::OK;
+      }
+
+      case StaticRedirectRule::kAutofill: {
+        replacements.SetSchemeStr("https");
+        replacements.SetHostStr(kBraveStaticProxy);
+        *new_url = request_url.ReplaceComponents(replacements);
+        return net::OK;
+      }
+
+      case StaticRedirectRule::kCRLSet: {
+        replacements.SetSchemeStr("https");
+        replacements.SetHostStr("crlsets.brave.com");
+        *new_url = request_url.ReplaceComponents(replacements);
+        return net::OK;
+      }
+
+      case StaticRedirectRule::kWidevine: {
+        // Widevine downloads are not proxied.
+        return net::OK;
+      }
+
+      case StaticRedirectRule::kRedirector: {
+        replacements.SetSchemeStr("https");
+        replacements.SetHostStr(kBraveRedirectorProxy);
+        *new_url = request_url.ReplaceComponents(replacements);
+        return net::OK;
+      }
+    }
   }
 
   return net::OK;
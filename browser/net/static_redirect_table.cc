@@ -0,0 +1,90 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/net/static_redirect_table.h"
+
+#include <algorithm>
+
+#include "base/check.h"
+#include "base/strings/string_piece.h"
+#include "base/strings/string_util.h"
+#include "url/gurl.h"
+
+namespace brave {
+
+StaticRedirectTable::StaticRedirectTable(const std::vector<Rule>& rules) {
+  rules_.reserve(rules.size());
+  for (const auto& rule : rules) {
+    URLPattern pattern(rule.valid_schemes);
+    const URLPattern::ParseResult result = pattern.Parse(rule.pattern);
+    DCHECK_EQ(URLPattern::ParseResult::kSuccess, result) << rule.pattern;
+
+    const size_t index = rules_.size();
+    if (pattern.host().empty()) {
+      rules_for_any_host_.push_back(index);
+    } else if (pattern.match_subdomains()) {
+      rules_by_domain_[pattern.host()].push_back(index);
+    } else {
+      rules_by_host_[pattern.host()].push_back(index);
+    }
+
+    rules_.push_back({rule.id, std::move(pattern), rule.match_host_only});
+  }
+}
+
+StaticRedirectTable::~StaticRedirectTable() = default;
+
+std::vector<int> StaticRedirectTable::GetMatchingRuleIds(
+    const GURL& url) const {
+  std::vector<size_t> candidates = rules_for_any_host_;
+
+  // URLPattern matches "example.com." as "example.com", so index lookups must
+  // also ignore a trailing dot.
+  base::StringPiece host = url.host_piece();
+  if (base::EndsWith(host, "."))
+    host.remove_suffix(1);
+
+  const auto host_iter = rules_by_host_.find(host);
+  if (host_iter != rules_by_host_.end()) {
+    candidates.insert(candidates.end(), host_iter->second.begin(),
+                      host_iter->second.end());
+  }
+
+  if (!rules_by_domain_.empty()) {
+    // Subdomain patterns also match their own host, so start with the whole
+    // host and then drop one label at a time.
+    base::StringPiece domain = host;
+    while (!domain.empty()) {
+      const auto domain_iter = rules_by_domain_.find(domain);
+      if (domain_iter != rules_by_domain_.end()) {
+        candidates.insert(candidates.end(), domain_iter->second.begin(),
+                          domain_iter->second.end());
+      }
+
+      const size_t pos = domain.find('.');
+      if (pos == base::StringPiece::npos)
+        break;
+      domain.remove_prefix(pos + 1);
+    }
+  }
+
+  std::vector<int> rule_ids;
+  if (candidates.empty())
+    return rule_ids;
+
+  std::sort(candidates.begin(), candidates.end());
+  for (const size_t index : candidates) {
+    const CompiledRule& rule = rules_[index];
+    const bool matches = rule.match_host_only
+                             ? rule.pattern.MatchesHost(url)
+                             : rule.pattern.MatchesURL(url);
+    if (matches)
+      rule_ids.push_back(rule.id);
+  }
+
+  return rule_ids;
+}
+
+}  // namespace brave
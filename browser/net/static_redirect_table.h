@@ -0,0 +1,62 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_BROWSER_NET_STATIC_REDIRECT_TABLE_H_
+#define BRAVE_BROWSER_NET_STATIC_REDIRECT_TABLE_H_
+
+#include <string>
+#include <vector>
+
+#include "base/containers/flat_map.h"
+#include "extensions/common/url_pattern.h"
+
+class GURL;
+
+namespace brave {
+
+// A table of URL patterns indexed by host, so that a request is only tested
+// against the few patterns which can match its host rather than every
+// pattern in turn. Rules keep their declaration order, which callers use as
+// priority.
+class StaticRedirectTable {
+ public:
+  struct Rule {
+    // Caller defined identifier returned for matching rules.
+    int id;
+    int valid_schemes;
+    const char* pattern;
+    // Only the host of the pattern is matched, as URLPattern::MatchesHost.
+    bool match_host_only = false;
+  };
+
+  explicit StaticRedirectTable(const std::vector<Rule>& rules);
+  ~StaticRedirectTable();
+
+  StaticRedirectTable(const StaticRedirectTable&) = delete;
+  StaticRedirectTable& operator=(const StaticRedirectTable&) = delete;
+
+  // Returns the ids of the rules matching |url| in declaration order.
+  std::vector<int> GetMatchingRuleIds(const GURL& url) const;
+
+ private:
+  struct CompiledRule {
+    int id;
+    URLPattern pattern;
+    bool match_host_only;
+  };
+
+  std::vector<CompiledRule> rules_;
+  // Indices into |rules_| by the exact host of the pattern.
+  base::flat_map<std::string, std::vector<size_t>> rules_by_host_;
+  // Indices into |rules_| for patterns such as "*.example.com", by the host
+  // without the subdomain wildcard.
+  base::flat_map<std::string, std::vector<size_t>> rules_by_domain_;
+  // Indices into |rules_| for patterns matching any host.
+  std::vector<size_t> rules_for_any_host_;
+};
+
+}  // namespace brave
+
+#endif  // BRAVE_BROWSER_NET_STATIC_REDIRECT_TABLE_H_
@@ -0,0 +1,97 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/net/static_redirect_table.h"
+
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+namespace brave {
+
+namespace {
+
+constexpr int kHttpAndHttps =
+    URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS;
+
+}  // namespace
+
+TEST(StaticRedirectTableTest, MatchesExactHost) {
+  const StaticRedirectTable table({{1, kHttpAndHttps, "*://dl.google.com/*"}});
+
+  EXPECT_EQ(std::vector<int>{1},
+            table.GetMatchingRuleIds(GURL("https://dl.google.com/foo")));
+  EXPECT_TRUE(
+      table.GetMatchingRuleIds(GURL("https://www.dl.google.com/foo")).empty());
+  EXPECT_TRUE(table.GetMatchingRuleIds(GURL("https://google.com/")).empty());
+}
+
+TEST(StaticRedirectTableTest, MatchesExactHostWithTrailingDot) {
+  const StaticRedirectTable table({{1, kHttpAndHttps, "*://dl.google.com/*"}});
+
+  EXPECT_EQ(std::vector<int>{1},
+            table.GetMatchingRuleIds(GURL("https://dl.google.com./foo")));
+}
+
+TEST(StaticRedirectTableTest, MatchesSubdomains) {
+  const StaticRedirectTable table({{1, kHttpAndHttps, "*://*.gvt1.com/*"}});
+
+  EXPECT_EQ(std::vector<int>{1},
+            table.GetMatchingRuleIds(GURL("http://gvt1.com/foo")));
+  EXPECT_EQ(std::vector<int>{1},
+            table.GetMatchingRuleIds(GURL("http://r1.sn.gvt1.com/foo")));
+  EXPECT_TRUE(table.GetMatchingRuleIds(GURL("http://gvt1.co/foo")).empty());
+  EXPECT_TRUE(table.GetMatchingRuleIds(GURL("http://xgvt1.com/foo")).empty());
+}
+
+TEST(StaticRedirectTableTest, MatchesSubdomainsWithTrailingDot) {
+  const StaticRedirectTable table({{1, kHttpAndHttps, "*://*.gvt1.com/*"}});
+
+  EXPECT_EQ(std::vector<int>{1},
+            table.GetMatchingRuleIds(GURL("http://gvt1.com./foo")));
+  EXPECT_EQ(std::vector<int>{1},
+            table.GetMatchingRuleIds(GURL("http://r1.gvt1.com./foo")));
+}
+
+TEST(StaticRedirectTableTest, MatchesPathAndScheme) {
+  const StaticRedirectTable table(
+      {{1, URLPattern::SCHEME_HTTPS, "https://www.gstatic.com/autofill/*"}});
+
+  EXPECT_EQ(std::vector<int>{1},
+            table.GetMatchingRuleIds(
+                GURL("https://www.gstatic.com/autofill/foo")));
+  EXPECT_TRUE(
+      table.GetMatchingRuleIds(GURL("https://www.gstatic.com/foo")).empty());
+  EXPECT_TRUE(
+      table.GetMatchingRuleIds(GURL("http://www.gstatic.com/autofill/foo"))
+          .empty());
+}
+
+TEST(StaticRedirectTableTest, MatchesHostOnly) {
+  const StaticRedirectTable table(
+      {{1, URLPattern::SCHEME_HTTPS, "https://safebrowsing.googleapis.com/",
+        /*match_host_only=*/true}});
+
+  EXPECT_EQ(std::vector<int>{1},
+            table.GetMatchingRuleIds(
+                GURL("https://safebrowsing.googleapis.com/v4/threatMatches")));
+}
+
+TEST(StaticRedirectTableTest, KeepsDeclarationOrder) {
+  const StaticRedirectTable table(
+      {{1, kHttpAndHttps, "*://*.gvt1.com/edgedl/*"},
+       {2, kHttpAndHttps, "*://redirector.gvt1.com/*"},
+       {3, kHttpAndHttps, "*://*.gvt1.com/*"},
+       {4, kHttpAndHttps, "*://dl.google.com/*"}});
+
+  EXPECT_EQ((std::vector<int>{1, 2, 3}),
+            table.GetMatchingRuleIds(
+                GURL("https://redirector.gvt1.com/edgedl/foo")));
+  EXPECT_EQ((std::vector<int>{2, 3}),
+            table.GetMatchingRuleIds(GURL("https://redirector.gvt1.com/foo")));
+}
+
+}  // namespace brave
@@ -60,6 +60,9 @@ using GetAccountStatementCallback = base::OnceCallback<
 using GetAdDiagnosticsCallback =
     base::OnceCallback<void(const bool, const std::string&)>;
 
+using ShouldCaptureHtmlForConversionCallback =
+    base::OnceCallback<void(const bool)>;
+
 class AdsService : public KeyedService {
  public:
   AdsService();
@@ -106,6 +109,10 @@ class AdsService : public KeyedService {
                             const std::vector<GURL>& redirect_chain,
                             const std::string& html) = 0;
 
+  virtual void ShouldCaptureHtmlForConversion(
+      const std::vector<GURL>& redirect_chain,
+      ShouldCaptureHtmlForConversionCallback callback) = 0;
+
   virtual void OnTextLoaded(const SessionID& tab_id,
                             const std::vector<GURL>& redirect_chain,
                             const std::string& text) = 0;
@@ -16,9 +16,11 @@
 #include "base/json/json_reader.h"
 #include "base/macros.h"
 #include "base/memory/ptr_util.h"
+#include "base/metrics/histogram_macros.h"
 #include "base/strings/utf_string_conversions.h"
 #include "base/task/post_task.h"
 #include "base/task/thread_pool.h"
+#include "base/timer/elapsed_timer.h"
 #include "brave/components/adblock_rust_ffi/src/wrapper.h"
 #include "brave/components/brave_component_updater/browser/dat_file_util.h"
 #include "brave/components/brave_shields/common/brave_shield_constants.h"
@@ -100,6 +102,26 @@ std::string ResourceTypeToString(blink::mojom::ResourceType resource_type) {
   return filter_option;
 }
 
+// Loads and, if |deserialize| is set, parses the list at |dat_file_path|.
+// Runs on the thread pool, so every list loads in parallel with the others.
+brave_shields::AdBlockBaseService::GetDATFileDataResult LoadAdBlockFileData(
+    bool deserialize,
+    const base::FilePath& dat_file_path) {
+  base::ElapsedTimer timer;
+  brave_shields::AdBlockBaseService::GetDATFileDataResult result =
+      deserialize
+          ? brave_component_updater::LoadDATFileData<adblock::Engine>(
+                dat_file_path)
+          : brave_component_updater::LoadRawFileData<adblock::Engine>(
+                dat_file_path);
+  const base::TimeDelta elapsed = timer.Elapsed();
+  UMA_HISTOGRAM_TIMES("Brave.Adblock.ListLoadTime", elapsed);
+  VLOG(1) << "Loaded ad block list " << dat_file_path.BaseName() << " ("
+          << result.second.size() << " bytes) in "
+          << elapsed.InMilliseconds() << "ms";
+  return result;
+}
+
 }  // namespace
 
 namespace brave_shields {
@@ -233,11 +255,7 @@ void AdBlockBaseService::GetDATFileData(const base::FilePath& dat_file_path,
                                         base::OnceClosure callback) {
   base::ThreadPool::PostTaskAndReplyWithResult(
       FROM_HERE, {base::MayBlock()},
-      base::BindOnce(
-          deserialize
-              ? &brave_component_updater::LoadDATFileData<adblock::Engine>
-              : &brave_component_updater::LoadRawFileData<adblock::Engine>,
-          dat_file_path),
+      base::BindOnce(&LoadAdBlockFileData, deserialize, dat_file_path),
       base::BindOnce(&AdBlockBaseService::OnGetDATFileData,
                      weak_factory_.GetWeakPtr(), std::move(callback)));
 }
@@ -252,17 +270,21 @@ void AdBlockBaseService::OnGetDATFileData(base::OnceClosure callback,
     LOG(ERROR) << "Failed to deserialize ad block data";
     return;
   }
-  GetTaskRunner()->PostTask(
-      FROM_HERE, base::BindOnce(&AdBlockBaseService::UpdateAdBlockClient,
-                                base::Unretained(this),
-                                std::move(result.first)));
-  // TODO(bridiver) this needs to happen after adblock client is actually reset
-  std::move(callback).Run();
+  // The new engine is fully built at this point, so requests never observe a
+  // partially loaded list. They only wait on the task runner while the known
+  // tags and resources are added to it. |callback| runs once the swap and
+  // that setup have happened.
+  GetTaskRunner()->PostTaskAndReply(
+      FROM_HERE,
+      base::BindOnce(&AdBlockBaseService::UpdateAdBlockClient,
+                     base::Unretained(this), std::move(result.first)),
+      std::move(callback));
 }
 
 void AdBlockBaseService::UpdateAdBlockClient(
     std::unique_ptr<adblock::Engine> ad_block_client) {
   DCHECK(GetTaskRunner()->RunsTasksInCurrentSequence());
+  SCOPED_UMA_HISTOGRAM_TIMER("Brave.Adblock.UpdateEngineTime");
   ad_block_client_ = std::move(ad_block_client);
   AddKnownTagsToAdBlockInstance();
   AddKnownResourcesToAdBlockInstance();
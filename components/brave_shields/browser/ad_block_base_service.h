@@ -84,10 +84,12 @@ class AdBlockBaseService : public BaseBraveShieldsService {
                     const std::string& resources = "",
                     bool include_redirect_urls = false);
 
+  // Swaps in |ad_block_client| and re-adds the known tags and resources.
+  void UpdateAdBlockClient(std::unique_ptr<adblock::Engine> ad_block_client);
+
   std::unique_ptr<adblock::Engine> ad_block_client_;
 
  private:
-  void UpdateAdBlockClient(std::unique_ptr<adblock::Engine> ad_block_client);
   void OnGetDATFileData(base::OnceClosure callback,
                         GetDATFileDataResult result);
   void OnPreferenceChanges(const std::string& pref_name);
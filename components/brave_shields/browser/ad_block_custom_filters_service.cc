@@ -5,6 +5,9 @@
 
 #include "brave/components/brave_shields/browser/ad_block_custom_filters_service.h"
 
+#include <utility>
+
+#include "base/files/file_util.h"
 #include "base/logging.h"
 #include "brave/components/adblock_rust_ffi/src/wrapper.h"
 #include "brave/components/brave_shields/browser/ad_block_service.h"
@@ -42,19 +45,49 @@ bool AdBlockCustomFiltersService::UpdateCustomFilters(
     return false;
   local_state->SetString(prefs::kAdBlockCustomFilters, custom_filters);
 
+  RebuildEngine(custom_filters);
+
+  return true;
+}
+
+void AdBlockCustomFiltersService::SetSubscriptionListFiles(
+    const std::vector<base::FilePath>& subscription_list_files) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  subscription_list_files_ = subscription_list_files;
+
+  // Init() builds the first engine with the current list files.
+  if (IsInitialized())
+    RebuildEngine(GetCustomFilters());
+}
+
+void AdBlockCustomFiltersService::RebuildEngine(
+    const std::string& custom_filters) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  // Posted to the same sequence that matches requests, so requests issued
+  // after this call see the new rules.
   GetTaskRunner()->PostTask(
       FROM_HERE,
       base::BindOnce(
           &AdBlockCustomFiltersService::UpdateCustomFiltersOnFileTaskRunner,
-          base::Unretained(this), custom_filters));
-
-  return true;
+          base::Unretained(this), custom_filters, subscription_list_files_));
 }
 
 void AdBlockCustomFiltersService::UpdateCustomFiltersOnFileTaskRunner(
-    const std::string& custom_filters) {
+    const std::string& custom_filters,
+    const std::vector<base::FilePath>& subscription_list_files) {
   DCHECK(GetTaskRunner()->RunsTasksInCurrentSequence());
-  ad_block_client_.reset(new adblock::Engine(custom_filters.c_str()));
+  std::string rules = custom_filters;
+  for (const auto& list_file : subscription_list_files) {
+    std::string list;
+    if (!base::ReadFileToString(list_file, &list)) {
+      LOG(ERROR) << "Failed to read subscription list " << list_file;
+      continue;
+    }
+    rules.append("\n");
+    rules.append(list);
+  }
+
+  UpdateAdBlockClient(std::make_unique<adblock::Engine>(rules));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -11,6 +11,7 @@
 #include <string>
 #include <vector>
 
+#include "base/files/file_path.h"
 #include "brave/components/brave_shields/browser/ad_block_base_service.h"
 
 class AdBlockServiceTest;
@@ -20,7 +21,8 @@ using brave_component_updater::BraveComponent;
 namespace brave_shields {
 
 // The brave shields service in charge of custom filter ad-block
-// checking and init.
+// checking and init. Enabled filter list subscriptions are compiled into the
+// same engine as the custom filters, so they are matched in a single pass.
 class AdBlockCustomFiltersService : public AdBlockBaseService {
  public:
   explicit AdBlockCustomFiltersService(BraveComponent::Delegate* delegate);
@@ -28,13 +30,22 @@ class AdBlockCustomFiltersService : public AdBlockBaseService {
 
   std::string GetCustomFilters();
   bool UpdateCustomFilters(const std::string& custom_filters);
+  // Replaces the cached subscription lists that are compiled together with
+  // the custom filters, and rebuilds the engine once the service has started.
+  void SetSubscriptionListFiles(
+      const std::vector<base::FilePath>& subscription_list_files);
 
  protected:
   bool Init() override;
 
  private:
   friend class ::AdBlockServiceTest;
-  void UpdateCustomFiltersOnFileTaskRunner(const std::string& custom_filters);
+  void RebuildEngine(const std::string& custom_filters);
+  void UpdateCustomFiltersOnFileTaskRunner(
+      const std::string& custom_filters,
+      const std::vector<base::FilePath>& subscription_list_files);
+
+  std::vector<base::FilePath> subscription_list_files_;
 
   DISALLOW_COPY_AND_ASSIGN(AdBlockCustomFiltersService);
 };
@@ -69,7 +69,6 @@ void AdBlockPrefService::OnPreferenceChanged(const std::string& pref_name) {
   ad_block_service_->EnableTag(tag, enabled);
   ad_block_service_->regional_service_manager()->EnableTag(tag, enabled);
   ad_block_service_->custom_filters_service()->EnableTag(tag, enabled);
-  ad_block_service_->subscription_service_manager()->EnableTag(tag, enabled);
 }
 
 }  // namespace brave_shields
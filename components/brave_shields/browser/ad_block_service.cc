@@ -97,13 +97,6 @@ void AdBlockService::ShouldStartRequest(
     return;
   }
 
-  subscription_service_manager()->ShouldStartRequest(
-      url, resource_type, tab_host, aggressive_blocking, did_match_rule,
-      did_match_exception, did_match_important, replacement_url);
-  if (did_match_important && *did_match_important) {
-    return;
-  }
-
   custom_filters_service()->ShouldStartRequest(
       url, resource_type, tab_host, aggressive_blocking, did_match_rule,
       did_match_exception, did_match_important, replacement_url);
@@ -152,14 +145,6 @@ absl::optional<base::Value> AdBlockService::UrlCosmeticResources(
                        /*force_hide=*/true);
   }
 
-  absl::optional<base::Value> subscription_resources =
-      subscription_service_manager()->UrlCosmeticResources(url);
-
-  if (subscription_resources && subscription_resources->is_dict()) {
-    MergeResourcesInto(std::move(*subscription_resources), &*resources,
-                       /*force_hide=*/true);
-  }
-
   return resources;
 }
 
@@ -189,21 +174,6 @@ absl::optional<base::Value> AdBlockService::HiddenClassIdSelectors(
       custom_filters_service()->HiddenClassIdSelectors(classes, ids,
                                                        exceptions);
 
-  absl::optional<base::Value> subscription_selectors =
-      subscription_service_manager()->HiddenClassIdSelectors(classes, ids,
-                                                             exceptions);
-
-  if (custom_selectors && custom_selectors->is_list()) {
-    if (subscription_selectors && subscription_selectors->is_list()) {
-      for (auto i = subscription_selectors->GetList().begin();
-           i < subscription_selectors->GetList().end(); i++) {
-        custom_selectors->Append(std::move(*i));
-      }
-    }
-  } else {
-    custom_selectors = std::move(subscription_selectors);
-  }
-
   if (!hide_selectors || !hide_selectors->is_list())
     hide_selectors = base::ListValue();
 
@@ -244,7 +214,13 @@ AdBlockService::AdBlockService(
         subscription_service_manager)
     : AdBlockBaseService(delegate),
       component_delegate_(delegate),
-      subscription_service_manager_(std::move(subscription_service_manager)) {}
+      subscription_service_manager_(std::move(subscription_service_manager)) {
+  // base::Unretained is ok here because the subscription service manager is
+  // owned by this service.
+  subscription_service_manager_->SetOnListFilesChangedCallback(
+      base::BindRepeating(&AdBlockService::OnSubscriptionListFilesChanged,
+                          base::Unretained(this)));
+}
 
 AdBlockService::~AdBlockService() {}
 
@@ -260,12 +236,18 @@ bool AdBlockService::Init() {
   return true;
 }
 
+void AdBlockService::OnSubscriptionListFilesChanged(
+    std::vector<base::FilePath> list_files) {
+  custom_filters_service()->SetSubscriptionListFiles(list_files);
+}
+
 void AdBlockService::OnComponentReady(const std::string& component_id,
                                       const base::FilePath& install_dir,
                                       const std::string& manifest) {
   // Regional service manager depends on regional catalog loading
+  custom_filters_service()->SetSubscriptionListFiles(
+      subscription_service_manager()->GetEnabledListFiles());
   custom_filters_service()->Start();
-  subscription_service_manager()->Start();
 
   base::FilePath dat_file_path = install_dir.AppendASCII(DAT_FILE);
   GetDATFileData(dat_file_path);
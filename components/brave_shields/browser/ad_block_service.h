@@ -93,6 +93,8 @@ class AdBlockService : public AdBlockBaseService {
       const std::string& component_id,
       const std::string& component_base64_public_key);
 
+  void OnSubscriptionListFilesChanged(std::vector<base::FilePath> list_files);
+
   BraveComponent::Delegate* component_delegate_;
 
   std::unique_ptr<brave_shields::AdBlockRegionalServiceManager>
@@ -5,14 +5,9 @@
 
 #include "brave/components/brave_shields/browser/ad_block_subscription_service.h"
 
-#include "base/files/file_path.h"
 #include "base/json/json_value_converter.h"
 #include "base/json/values_util.h"
-#include "base/logging.h"
 #include "base/strings/string_piece.h"
-#include "brave/components/brave_shields/browser/ad_block_service.h"
-#include "brave/components/brave_shields/browser/ad_block_service_helper.h"
-#include "brave/components/brave_shields/common/brave_shield_constants.h"
 
 namespace brave_shields {
 
@@ -46,43 +41,4 @@ void SubscriptionInfo::RegisterJSONConverter(
   converter->RegisterBoolField("enabled", &SubscriptionInfo::enabled);
 }
 
-AdBlockSubscriptionService::AdBlockSubscriptionService(
-    const SubscriptionInfo& info,
-    const base::FilePath list_file,
-    brave_component_updater::BraveComponent::Delegate* delegate)
-    : AdBlockBaseService(delegate),
-      subscription_url_(info.subscription_url),
-      list_file_(list_file),
-      load_on_start_(info.last_successful_update_attempt != base::Time::Min()),
-      initialized_(false) {}
-
-AdBlockSubscriptionService::~AdBlockSubscriptionService() {}
-
-bool AdBlockSubscriptionService::Init() {
-  if (!AdBlockBaseService::Init())
-    return false;
-
-  // if we already have local data, go ahead and load it
-  if (load_on_start_) {
-    load_on_start_ = false;
-    ReloadList();
-    // return false so we don't set the component to initialized until the data
-    // is loaded
-    return false;
-  }
-
-  return initialized_;
-}
-
-void AdBlockSubscriptionService::ReloadList() {
-  GetDATFileData(list_file_, false,
-                 base::BindOnce(&AdBlockSubscriptionService::OnListLoaded,
-                                weak_factory_.GetWeakPtr()));
-}
-
-void AdBlockSubscriptionService::OnListLoaded() {
-  Start();
-  initialized_ = true;
-}
-
 }  // namespace brave_shields
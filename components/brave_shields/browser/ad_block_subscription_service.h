@@ -6,13 +6,7 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_AD_BLOCK_SUBSCRIPTION_SERVICE_H_
 #define BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_AD_BLOCK_SUBSCRIPTION_SERVICE_H_
 
-#include <memory>
-#include <string>
-#include <vector>
-
-#include "base/files/file_path.h"
 #include "base/time/time.h"
-#include "brave/components/brave_shields/browser/ad_block_base_service.h"
 #include "url/gurl.h"
 
 namespace base {
@@ -20,8 +14,6 @@ template <typename StructType>
 class JSONValueConverter;
 }
 
-class AdBlockServiceTest;
-
 namespace brave_shields {
 
 struct SubscriptionInfo {
@@ -44,38 +36,6 @@ struct SubscriptionInfo {
       base::JSONValueConverter<SubscriptionInfo>*);
 };
 
-// The brave shields service in charge of ad-block checking and init
-// for a custom filter list subscription.
-class AdBlockSubscriptionService : public AdBlockBaseService {
- public:
-  using OnLoadCallback = base::RepeatingCallback<void(const GURL&)>;
-  explicit AdBlockSubscriptionService(
-      const SubscriptionInfo& info,
-      base::FilePath list_file,
-      brave_component_updater::BraveComponent::Delegate* delegate);
-  ~AdBlockSubscriptionService() override;
-
-  void ReloadList();
-
-  bool Init() override;
-
- private:
-  friend class ::AdBlockServiceTest;
-
-  void OnListLoaded();
-
-  GURL subscription_url_;
-  base::FilePath list_file_;
-  bool load_on_start_;
-  bool initialized_;
-
-  base::WeakPtrFactory<AdBlockSubscriptionService> weak_factory_{this};
-
-  AdBlockSubscriptionService(const AdBlockSubscriptionService&) = delete;
-  AdBlockSubscriptionService& operator=(const AdBlockSubscriptionService&) =
-      delete;
-};
-
 }  // namespace brave_shields
 
 #endif  // BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_AD_BLOCK_SUBSCRIPTION_SERVICE_H_
@@ -19,8 +19,6 @@
 #include "base/task/thread_pool.h"
 #include "base/time/time.h"
 #include "base/values.h"
-#include "brave/components/adblock_rust_ffi/src/wrapper.h"
-#include "brave/components/brave_shields/browser/ad_block_service_helper.h"
 #include "brave/components/brave_shields/browser/ad_block_subscription_service.h"
 #include "brave/components/brave_shields/browser/ad_block_subscription_service_manager_observer.h"
 #include "brave/components/brave_shields/common/brave_shield_constants.h"
@@ -114,7 +112,6 @@ void AdBlockSubscriptionServiceManager::OnUpdateTimer(
   if (!local_state)
     return;
 
-  base::AutoLock lock(subscription_services_lock_);
   subscriptions_ = base::DictionaryValue::From(base::Value::ToUniquePtrValue(
       local_state->GetDictionary(prefs::kAdBlockListSubscriptions)->Clone()));
 
@@ -164,18 +161,8 @@ void AdBlockSubscriptionServiceManager::CreateSubscription(
   info.last_successful_update_attempt = base::Time();
   info.enabled = true;
 
-  auto subscription_service = std::make_unique<AdBlockSubscriptionService>(
-      info, GetSubscriptionPath(sub_url).Append(kCustomSubscriptionListText),
-      delegate_);
   UpdateSubscriptionPrefs(sub_url, info);
 
-  {
-    base::AutoLock lock(subscription_services_lock_);
-    // this could allow more than one service for a given url
-    subscription_services_.insert(
-        std::make_pair(sub_url, std::move(subscription_service)));
-  }
-
   StartDownload(sub_url, true);
 }
 
@@ -184,15 +171,41 @@ AdBlockSubscriptionServiceManager::GetSubscriptions() {
   DCHECK_CALLED_ON_VALID_THREAD(thread_checker_);
   auto infos = std::vector<SubscriptionInfo>();
 
-  for (const auto& subscription_service : subscription_services_) {
-    auto info = GetInfo(subscription_service.first);
-    DCHECK(info);
-    infos.push_back(*info);
+  for (base::DictionaryValue::Iterator it(*subscriptions_); !it.IsAtEnd();
+       it.Advance()) {
+    if (!it.value().is_dict())
+      continue;
+    infos.push_back(BuildInfoFromDict(GURL(it.key()), &it.value()));
   }
 
   return infos;
 }
 
+std::vector<base::FilePath>
+AdBlockSubscriptionServiceManager::GetEnabledListFiles() {
+  DCHECK_CALLED_ON_VALID_THREAD(thread_checker_);
+  std::vector<base::FilePath> list_files;
+
+  for (const auto& info : GetSubscriptions()) {
+    // Lists that were never downloaded have no cached file yet.
+    if (!info.enabled || info.last_successful_update_attempt.is_null() ||
+        info.last_successful_update_attempt == base::Time::Min()) {
+      continue;
+    }
+
+    list_files.push_back(GetSubscriptionPath(info.subscription_url)
+                             .Append(kCustomSubscriptionListText));
+  }
+
+  return list_files;
+}
+
+void AdBlockSubscriptionServiceManager::SetOnListFilesChangedCallback(
+    ListFilesChangedCallback callback) {
+  DCHECK_CALLED_ON_VALID_THREAD(thread_checker_);
+  on_list_files_changed_ = std::move(callback);
+}
+
 void AdBlockSubscriptionServiceManager::EnableSubscription(const GURL& sub_url,
                                                            bool enabled) {
   DCHECK_CALLED_ON_VALID_THREAD(thread_checker_);
@@ -202,18 +215,15 @@ void AdBlockSubscriptionServiceManager::EnableSubscription(const GURL& sub_url,
   info->enabled = enabled;
 
   UpdateSubscriptionPrefs(sub_url, *info);
+  NotifyListFilesChanged();
 }
 
 void AdBlockSubscriptionServiceManager::DeleteSubscription(
     const GURL& sub_url) {
   DCHECK_CALLED_ON_VALID_THREAD(thread_checker_);
-  {
-    base::AutoLock lock(subscription_services_lock_);
-    auto it = subscription_services_.find(sub_url);
-    DCHECK(it != subscription_services_.end());
-    subscription_services_.erase(it);
-  }
+  DCHECK(GetInfo(sub_url));
   ClearSubscriptionPrefs(sub_url);
+  NotifyListFilesChanged();
 
   base::ThreadPool::PostTask(
       FROM_HERE,
@@ -246,7 +256,7 @@ void AdBlockSubscriptionServiceManager::OnGetDownloadManager(
       base::Unretained(this)));
 
   download_manager_->CancelAllPendingDownloads();
-  LoadSubscriptionServices();
+  LoadSubscriptions();
 
   subscription_update_timer_->Schedule(
       kListCheckInitialDelay, kListRetryInterval,
@@ -276,36 +286,16 @@ absl::optional<SubscriptionInfo> AdBlockSubscriptionServiceManager::GetInfo(
       BuildInfoFromDict(sub_url, list_subscription_dict));
 }
 
-void AdBlockSubscriptionServiceManager::LoadSubscriptionServices() {
+void AdBlockSubscriptionServiceManager::LoadSubscriptions() {
   DCHECK_CALLED_ON_VALID_THREAD(thread_checker_);
 
   PrefService* local_state = delegate_->local_state();
   if (!local_state)
     return;
 
-  base::AutoLock lock(subscription_services_lock_);
   subscriptions_ = base::DictionaryValue::From(base::Value::ToUniquePtrValue(
       local_state->GetDictionary(prefs::kAdBlockListSubscriptions)->Clone()));
-
-  for (base::DictionaryValue::Iterator it(*subscriptions_); !it.IsAtEnd();
-       it.Advance()) {
-    const std::string key = it.key();
-    SubscriptionInfo info;
-    const base::Value* list_subscription_dict =
-        subscriptions_->FindDictKey(key);
-    if (list_subscription_dict) {
-      GURL sub_url(key);
-      info = BuildInfoFromDict(sub_url, list_subscription_dict);
-
-      auto subscription_service = std::make_unique<AdBlockSubscriptionService>(
-          info,
-          GetSubscriptionPath(sub_url).Append(kCustomSubscriptionListText),
-          delegate_);
-
-      subscription_services_.insert(
-          std::make_pair(sub_url, std::move(subscription_service)));
-    }
-  }
+  NotifyListFilesChanged();
 }
 
 // Updates preferences to reflect a new state for the specified filter list
@@ -330,7 +320,6 @@ void AdBlockSubscriptionServiceManager::UpdateSubscriptionPrefs(
   subscriptions_dict->SetKey(sub_url.spec(), std::move(subscription_dict));
 
   // TODO(bridiver) - change to pref registrar
-  base::AutoLock lock(subscription_services_lock_);
   subscriptions_ = base::DictionaryValue::From(
       base::Value::ToUniquePtrValue(subscriptions_dict->Clone()));
 }
@@ -349,120 +338,13 @@ void AdBlockSubscriptionServiceManager::ClearSubscriptionPrefs(
   subscriptions_dict->RemoveKey(sub_url.spec());
 
   // TODO(bridiver) - change to pref registrar
-  base::AutoLock lock(subscription_services_lock_);
   subscriptions_ = base::DictionaryValue::From(
       base::Value::ToUniquePtrValue(subscriptions_dict->Clone()));
 }
 
-bool AdBlockSubscriptionServiceManager::Start() {
-  DCHECK_CALLED_ON_VALID_THREAD(thread_checker_);
-  for (const auto& subscription_service : subscription_services_) {
-    subscription_service.second->Start();
-  }
-  return true;
-}
-
-void AdBlockSubscriptionServiceManager::ShouldStartRequest(
-    const GURL& url,
-    blink::mojom::ResourceType resource_type,
-    const std::string& tab_host,
-    bool aggressive_blocking,
-    bool* did_match_rule,
-    bool* did_match_exception,
-    bool* did_match_important,
-    std::string* adblock_replacement_url) {
-  base::AutoLock lock(subscription_services_lock_);
-  for (const auto& subscription_service : subscription_services_) {
-    auto info = GetInfo(subscription_service.first);
-    if (info && info->enabled) {
-      subscription_service.second->ShouldStartRequest(
-          url, resource_type, tab_host, aggressive_blocking, did_match_rule,
-          did_match_exception, did_match_important, adblock_replacement_url);
-      if (did_match_important && *did_match_important) {
-        return;
-      }
-    }
-  }
-}
-
-void AdBlockSubscriptionServiceManager::EnableTag(const std::string& tag,
-                                                  bool enabled) {
-  DCHECK_CALLED_ON_VALID_THREAD(thread_checker_);
-  for (const auto& subscription_service : subscription_services_) {
-    subscription_service.second->EnableTag(tag, enabled);
-  }
-}
-
-void AdBlockSubscriptionServiceManager::AddResources(
-    const std::string& resources) {
-  DCHECK_CALLED_ON_VALID_THREAD(thread_checker_);
-  for (const auto& subscription_service : subscription_services_) {
-    subscription_service.second->AddResources(resources);
-  }
-}
-
-absl::optional<base::Value>
-AdBlockSubscriptionServiceManager::UrlCosmeticResources(
-    const std::string& url) {
-  absl::optional<base::Value> first_value = absl::nullopt;
-
-  base::AutoLock lock(subscription_services_lock_);
-  for (auto it = subscription_services_.begin();
-       it != subscription_services_.end(); it++) {
-    auto info = GetInfo(it->first);
-    if (info && info->enabled) {
-      absl::optional<base::Value> next_value =
-          it->second->UrlCosmeticResources(url);
-      if (first_value) {
-        if (next_value) {
-          MergeResourcesInto(std::move(*next_value), &*first_value, false);
-        }
-      } else {
-        first_value = std::move(next_value);
-      }
-    }
-  }
-
-  return first_value;
-}
-
-absl::optional<base::Value>
-AdBlockSubscriptionServiceManager::HiddenClassIdSelectors(
-    const std::vector<std::string>& classes,
-    const std::vector<std::string>& ids,
-    const std::vector<std::string>& exceptions) {
-  absl::optional<base::Value> first_value = absl::nullopt;
-
-  base::AutoLock lock(subscription_services_lock_);
-  for (auto it = subscription_services_.begin();
-       it != subscription_services_.end(); it++) {
-    auto info = GetInfo(it->first);
-    if (info && info->enabled) {
-      absl::optional<base::Value> next_value =
-          it->second->HiddenClassIdSelectors(classes, ids, exceptions);
-      if (first_value && first_value->is_list()) {
-        if (next_value && next_value->is_list()) {
-          for (auto i = next_value->GetList().begin();
-               i < next_value->GetList().end(); i++) {
-            first_value->Append(std::move(*i));
-          }
-        }
-      } else {
-        first_value = std::move(next_value);
-      }
-    }
-  }
-
-  return first_value;
-}
-
 void AdBlockSubscriptionServiceManager::OnSubscriptionDownloaded(
     const GURL& sub_url) {
   DCHECK_CALLED_ON_VALID_THREAD(thread_checker_);
-  auto it = subscription_services_.find(sub_url);
-  if (it == subscription_services_.end())
-    return;
-
   auto info = GetInfo(sub_url);
   if (!info)
     return;
@@ -471,8 +353,7 @@ void AdBlockSubscriptionServiceManager::OnSubscriptionDownloaded(
   info->last_successful_update_attempt = info->last_update_attempt;
   UpdateSubscriptionPrefs(sub_url, *info);
 
-  it->second->ReloadList();
-
+  NotifyListFilesChanged();
   NotifyObserversOfServiceEvent();
 }
 
@@ -488,6 +369,11 @@ void AdBlockSubscriptionServiceManager::OnSubscriptionDownloadFailure(
   NotifyObserversOfServiceEvent();
 }
 
+void AdBlockSubscriptionServiceManager::NotifyListFilesChanged() {
+  if (on_list_files_changed_)
+    on_list_files_changed_.Run(GetEnabledListFiles());
+}
+
 void AdBlockSubscriptionServiceManager::NotifyObserversOfServiceEvent() {
   for (auto& observer : observers_) {
     observer.OnServiceUpdateEvent();
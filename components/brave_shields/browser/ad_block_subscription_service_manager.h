@@ -6,16 +6,15 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_AD_BLOCK_SUBSCRIPTION_SERVICE_MANAGER_H_
 #define BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_AD_BLOCK_SUBSCRIPTION_SERVICE_MANAGER_H_
 
-#include <map>
 #include <memory>
 #include <string>
 #include <vector>
 
+#include "base/callback.h"
 #include "base/files/file_path.h"
 #include "base/macros.h"
 #include "base/memory/weak_ptr.h"
-#include "base/one_shot_event.h"
-#include "base/synchronization/lock.h"
+#include "base/observer_list.h"
 #include "base/threading/thread_checker.h"
 #include "base/values.h"
 #include "brave/components/brave_component_updater/browser/brave_component.h"
@@ -37,10 +36,14 @@ using brave_component_updater::BraveComponent;
 
 namespace brave_shields {
 
-// The AdBlock subscription service manager, in charge of initializing and
-// managing AdBlock clients corresponding to custom filter list subscriptions.
+// The AdBlock subscription service manager, in charge of downloading and
+// tracking custom filter list subscriptions. The lists themselves are matched
+// by the custom filters engine, see |SetOnListFilesChangedCallback|.
 class AdBlockSubscriptionServiceManager {
  public:
+  using ListFilesChangedCallback =
+      base::RepeatingCallback<void(std::vector<base::FilePath>)>;
+
   explicit AdBlockSubscriptionServiceManager(
       BraveComponent::Delegate* delegate,
       AdBlockSubscriptionDownloadManager::DownloadManagerGetter getter,
@@ -57,23 +60,12 @@ class AdBlockSubscriptionServiceManager {
   void RefreshSubscription(const GURL& sub_url, bool from_ui);
   void CreateSubscription(const GURL& sub_url);
 
-  bool Start();
-  void ShouldStartRequest(const GURL& url,
-                          blink::mojom::ResourceType resource_type,
-                          const std::string& tab_host,
-                          bool aggressive_blocking,
-                          bool* did_match_rule,
-                          bool* did_match_exception,
-                          bool* did_match_important,
-                          std::string* adblock_replacement_url);
-  void EnableTag(const std::string& tag, bool enabled);
-  void AddResources(const std::string& resources);
-
-  absl::optional<base::Value> UrlCosmeticResources(const std::string& url);
-  absl::optional<base::Value> HiddenClassIdSelectors(
-      const std::vector<std::string>& classes,
-      const std::vector<std::string>& ids,
-      const std::vector<std::string>& exceptions);
+  // Returns the cached list files of all enabled subscriptions which have
+  // been downloaded.
+  std::vector<base::FilePath> GetEnabledListFiles();
+  // |callback| is run with |GetEnabledListFiles()| whenever a subscription is
+  // loaded, enabled, disabled, deleted or downloaded.
+  void SetOnListFilesChangedCallback(ListFilesChangedCallback callback);
 
   AdBlockSubscriptionDownloadManager* download_manager() {
     return download_manager_.get();
@@ -97,7 +89,7 @@ class AdBlockSubscriptionServiceManager {
   void StartDownload(const GURL& sub_url, bool from_ui);
 
   bool Init();
-  void LoadSubscriptionServices();
+  void LoadSubscriptions();
   void UpdateSubscriptionPrefs(const GURL& sub_url,
                                const SubscriptionInfo& info);
   void ClearSubscriptionPrefs(const GURL& sub_url);
@@ -105,6 +97,7 @@ class AdBlockSubscriptionServiceManager {
       AdBlockSubscriptionDownloadManager* download_manager);
 
   absl::optional<SubscriptionInfo> GetInfo(const GURL& sub_url);
+  void NotifyListFilesChanged();
   void NotifyObserversOfServiceEvent();
 
   void SetUpdateIntervalsForTesting(base::TimeDelta* initial_delay,
@@ -114,14 +107,11 @@ class AdBlockSubscriptionServiceManager {
   base::WeakPtr<AdBlockSubscriptionDownloadManager> download_manager_;
   base::FilePath subscription_path_;
   std::unique_ptr<base::DictionaryValue> subscriptions_;
-
-  std::map<GURL, std::unique_ptr<AdBlockSubscriptionService>>
-      subscription_services_;
   std::unique_ptr<component_updater::TimerUpdateScheduler>
       subscription_update_timer_;
 
+  ListFilesChangedCallback on_list_files_changed_;
   base::ObserverList<AdBlockSubscriptionServiceManagerObserver> observers_;
-  base::Lock subscription_services_lock_;
 
   THREAD_CHECKER(thread_checker_);
 
@@ -28,3 +28,26 @@ TEST(HTTPSEverywhereRecentlyUsedCacheTest, Operations) {
   cache.remove("kD");
   ASSERT_FALSE(cache.get("kD", &v));
 }
+
+TEST(HTTPSEverywhereRecentlyUsedCacheTest, ShardedOperations) {
+  using Cache = HTTPSERecentlyUsedCache<std::string>;
+  Cache cache(64, 4);
+
+  for (int i = 0; i < 8; i++)
+    cache.add("k" + std::to_string(i), "v" + std::to_string(i));
+
+  std::string v;
+  for (int i = 0; i < 8; i++) {
+    ASSERT_TRUE(cache.get("k" + std::to_string(i), &v));
+    ASSERT_EQ(v, "v" + std::to_string(i));
+  }
+
+  cache.remove("k3");
+  ASSERT_FALSE(cache.get("k3", &v));
+  ASSERT_TRUE(cache.get("k4", &v));
+
+  // Test clear.
+  cache.clear();
+  for (int i = 0; i < 8; i++)
+    ASSERT_FALSE(cache.get("k" + std::to_string(i), &v));
+}
@@ -6,6 +6,8 @@
 #include "brave/components/brave_shields/browser/https_everywhere_service.h"
 
 #include <algorithm>
+#include <memory>
+#include <numeric>
 #include <string>
 #include <utility>
 #include <vector>
@@ -28,6 +30,8 @@
 #define DAT_FILE_VERSION "6.0"
 #define HTTPSE_URLS_REDIRECTS_COUNT_QUEUE   1
 #define HTTPSE_URL_MAX_REDIRECTS_COUNT      5
+#define HTTPSE_CACHE_SIZE                   1024
+#define HTTPSE_CACHE_SHARD_COUNT            16
 
 namespace {
 
@@ -66,14 +70,34 @@ std::vector<std::string> ExpandDomainForLookup(const std::string& domain) {
   }
   return resultDomains;
 }
-std::string leveldbGet(leveldb::DB* db, const std::string &key) {
-  if (!db) {
-    return "";
+
+// Looks up all |keys| with a single iterator, seeking forward through them
+// in sorted order. Returns the values in the same order as |keys|, with an
+// empty string for each key that is not in the database.
+std::vector<std::string> leveldbGetMany(leveldb::DB* db,
+                                        const std::vector<std::string>& keys) {
+  std::vector<std::string> values(keys.size());
+  if (!db || keys.empty()) {
+    return values;
   }
 
-  std::string value;
-  leveldb::Status s = db->Get(leveldb::ReadOptions(), key, &value);
-  return s.ok() ? value : "";
+  std::vector<size_t> order(keys.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(),
+            [&keys](size_t lhs, size_t rhs) { return keys[lhs] < keys[rhs]; });
+
+  std::unique_ptr<leveldb::Iterator> it(
+      db->NewIterator(leveldb::ReadOptions()));
+  for (size_t index : order) {
+    it->Seek(keys[index]);
+    if (!it->Valid()) {
+      break;
+    }
+    if (it->key() == leveldb::Slice(keys[index])) {
+      values[index] = it->value().ToString();
+    }
+  }
+  return values;
 }
 
 }  // namespace
@@ -101,6 +125,8 @@ HTTPSEverywhereService::g_https_everywhere_component_base64_public_key_(
 HTTPSEverywhereService::HTTPSEverywhereService(
     BraveComponent::Delegate* delegate)
     : BaseBraveShieldsService(delegate),
+      recently_used_cache_(HTTPSE_CACHE_SIZE, HTTPSE_CACHE_SHARD_COUNT),
+      no_rules_cache_(HTTPSE_CACHE_SIZE, HTTPSE_CACHE_SHARD_COUNT),
       level_db_(nullptr) {
   DETACH_FROM_SEQUENCE(sequence_checker_);
 }
@@ -130,6 +156,10 @@ void HTTPSEverywhereService::InitDB(const base::FilePath& install_dir) {
 
   CloseDatabase();
 
+  // Cached results were computed against the previous rule set
+  recently_used_cache_.clear();
+  no_rules_cache_.clear();
+
   leveldb::Options options;
   leveldb::Status status =
       leveldb::DB::Open(options,
@@ -182,11 +212,18 @@ bool HTTPSEverywhereService::GetHTTPSURL(
   }
 
   SCOPED_UMA_HISTOGRAM_TIMER("Brave.HTTPSE.GetHTTPSURL");
-  const std::vector<std::string> domains =
-      ExpandDomainForLookup(candidate_url.host());
-  for (auto domain : domains) {
-    std::string value = leveldbGet(level_db_, domain);
+  const std::string& host = candidate_url.host();
+  bool no_rules = false;
+  if (no_rules_cache_.get(host, &no_rules)) {
+    return false;
+  }
+
+  const std::vector<std::string> domains = ExpandDomainForLookup(host);
+  const std::vector<std::string> values = leveldbGetMany(level_db_, domains);
+  bool has_rules = false;
+  for (const auto& value : values) {
     if (!value.empty()) {
+      has_rules = true;
       *new_url = ApplyHTTPSRule(candidate_url.spec(), value);
       if (0 != new_url->length()) {
         recently_used_cache_.add(candidate_url.spec(), *new_url);
@@ -195,6 +232,9 @@ bool HTTPSEverywhereService::GetHTTPSURL(
       }
     }
   }
+  if (!has_rules) {
+    no_rules_cache_.add(host, true);
+  }
   recently_used_cache_.remove(candidate_url.spec());
   return false;
 }
@@ -84,6 +84,8 @@ class HTTPSEverywhereService : public BaseBraveShieldsService,
   base::Lock httpse_get_urls_redirects_count_mutex_;
   std::vector<HTTPSE_REDIRECTS_COUNT_ST> httpse_urls_redirects_count_;
   HTTPSERecentlyUsedCache<std::string> recently_used_cache_;
+  // Hosts for which the database has no rules for any candidate domain
+  HTTPSERecentlyUsedCache<bool> no_rules_cache_;
   leveldb::DB* level_db_;
 
   SEQUENCE_CHECKER(sequence_checker_);
@@ -13,6 +13,7 @@
 #include "base/bind.h"
 #include "base/callback_forward.h"
 #include "base/one_shot_event.h"
+#include "base/task/thread_pool.h"
 #include "brave/components/api_request_helper/api_request_helper.h"
 #include "brave/components/brave_private_cdn/headers.h"
 #include "brave/components/brave_today/browser/feed_building.h"
@@ -34,6 +35,18 @@ GURL GetFeedUrl() {
   return feed_url;
 }
 
+// Parsing and building a big feed is expensive, so this runs on the thread
+// pool.
+mojom::FeedPtr BuildFeedOnWorker(std::string body,
+                                 std::unordered_set<std::string> history_hosts,
+                                 Publishers publishers) {
+  auto feed = mojom::Feed::New();
+  if (!BuildFeed(body, history_hosts, &publishers, feed.get())) {
+    return nullptr;
+  }
+  return feed;
+}
+
 }  // namespace
 
 FeedController::FeedController(
@@ -87,6 +100,7 @@ void FeedController::EnsureFeedIsUpdating() {
     return;
   }
   is_update_in_progress_ = true;
+  update_generation_ = cache_generation_;
 
   // Fetch https request via callback
   // TODO(petemill): avoid callback hell when c++ allows
@@ -110,7 +124,7 @@ void FeedController::EnsureFeedIsUpdating() {
 
         // Fetch publishers via callback
         auto onPublishers = base::BindOnce(
-            [](FeedController* controller, const std::string& body,
+            [](FeedController* controller, std::string body,
                const std::string& etag, Publishers publishers) {
               // Handle no publishers
               if (publishers.empty()) {
@@ -120,7 +134,7 @@ void FeedController::EnsureFeedIsUpdating() {
               }
               // Get history hosts via callback
               auto onHistory = base::BindOnce(
-                  [](FeedController* controller, const std::string& body,
+                  [](FeedController* controller, std::string body,
                      const std::string& etag, Publishers publishers,
                      history::QueryResults results) {
                     std::unordered_set<std::string> history_hosts;
@@ -129,18 +143,14 @@ void FeedController::EnsureFeedIsUpdating() {
                       history_hosts.insert(host);
                     }
                     VLOG(1) << "history hosts # " << history_hosts.size();
-                    // Parse directly to in-memory property
-                    controller->ResetFeed();
-                    if (BuildFeed(body, history_hosts, &publishers,
-                                  &controller->current_feed_)) {
-                      // Only mark cache time of remote request if
-                      // parsing was successful
-                      controller->current_feed_etag_ = etag;
-                    } else {
-                      VLOG(1) << "ParseFeed reported failure.";
-                    }
-                    // Let any callbacks know that the data is ready or errored.
-                    controller->NotifyUpdateDone();
+                    base::ThreadPool::PostTaskAndReplyWithResult(
+                        FROM_HERE, {base::TaskPriority::USER_VISIBLE},
+                        base::BindOnce(&BuildFeedOnWorker, std::move(body),
+                                       std::move(history_hosts),
+                                       std::move(publishers)),
+                        base::BindOnce(
+                            &FeedController::OnFeedBuilt,
+                            controller->weak_ptr_factory_.GetWeakPtr(), etag));
                   },
                   base::Unretained(controller), std::move(body),
                   std::move(etag), std::move(publishers));
@@ -215,6 +225,7 @@ void FeedController::UpdateIfRemoteChanged() {
 
 void FeedController::ClearCache() {
   ResetFeed();
+  cache_generation_++;
 }
 
 void FeedController::OnPublishersUpdated(PublishersController* controller) {
@@ -238,6 +249,30 @@ void FeedController::GetOrFetchFeed(base::OnceClosure callback) {
   EnsureFeedIsUpdating();
 }
 
+void FeedController::OnFeedBuilt(const std::string& etag,
+                                 mojom::FeedPtr feed) {
+  if (update_generation_ != cache_generation_) {
+    // The cache was cleared while this update was in flight, so its result
+    // may be stale. Start over; waiting callbacks get the new feed.
+    VLOG(1) << "Discarding feed built before the cache was cleared";
+    is_update_in_progress_ = false;
+    EnsureFeedIsUpdating();
+    return;
+  }
+  ResetFeed();
+  if (feed) {
+    current_feed_.hash = std::move(feed->hash);
+    current_feed_.pages = std::move(feed->pages);
+    current_feed_.featured_item = std::move(feed->featured_item);
+    // Only mark cache time of remote request if parsing was successful
+    current_feed_etag_ = etag;
+  } else {
+    VLOG(1) << "ParseFeed reported failure.";
+  }
+  // Let any callbacks know that the data is ready or errored.
+  NotifyUpdateDone();
+}
+
 void FeedController::ResetFeed() {
   current_feed_.featured_item = nullptr;
   current_feed_.hash = "";
@@ -9,6 +9,7 @@
 #include <memory>
 #include <string>
 
+#include "base/memory/weak_ptr.h"
 #include "base/one_shot_event.h"
 #include "base/scoped_observation.h"
 #include "brave/components/api_request_helper/api_request_helper.h"
@@ -59,6 +60,7 @@ class FeedController : public PublishersController::Observer {
 
  private:
   void GetOrFetchFeed(base::OnceClosure callback);
+  void OnFeedBuilt(const std::string& etag, mojom::FeedPtr feed);
   void ResetFeed();
   void NotifyUpdateDone();
 
@@ -78,6 +80,11 @@ class FeedController : public PublishersController::Observer {
   mojom::Feed current_feed_;
   std::string current_feed_etag_;
   bool is_update_in_progress_ = false;
+  // Bumped by ClearCache() so that an update which was already in flight,
+  // e.g. with a feed built for a previous region, is not cached.
+  int cache_generation_ = 0;
+  int update_generation_ = 0;
+  base::WeakPtrFactory<FeedController> weak_ptr_factory_{this};
 };
 
 }  // namespace brave_news
@@ -0,0 +1,193 @@
+// Copyright (c) 2021 The Brave Authors. All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this file,
+// you can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "brave/components/brave_today/browser/feed_controller.h"
+
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "base/files/scoped_temp_dir.h"
+#include "base/run_loop.h"
+#include "base/strings/stringprintf.h"
+#include "base/test/bind.h"
+#include "brave/components/api_request_helper/api_request_helper.h"
+#include "brave/components/brave_today/browser/feed_building.h"
+#include "brave/components/brave_today/browser/publishers_controller.h"
+#include "brave/components/brave_today/browser/publishers_parsing.h"
+#include "brave/components/brave_today/browser/urls.h"
+#include "brave/components/brave_today/common/brave_news.mojom.h"
+#include "brave/components/brave_today/common/pref_names.h"
+#include "components/history/core/browser/history_service.h"
+#include "components/history/core/test/history_service_test_util.h"
+#include "components/prefs/testing_pref_service.h"
+#include "content/public/test/browser_task_environment.h"
+#include "net/traffic_annotation/network_traffic_annotation_test_helper.h"
+#include "services/network/public/cpp/weak_wrapper_shared_url_loader_factory.h"
+#include "services/network/test/test_url_loader_factory.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace brave_news {
+
+namespace {
+
+const char kPublishersJson[] = R"([
+  {
+    "publisher_id": "111",
+    "publisher_name": "Test Publisher 1",
+    "category": "Tech",
+    "enabled": true
+  }
+])";
+
+std::string GetFeedJson(const std::string& article_url) {
+  return base::StringPrintf(R"([
+    {
+      "category": "Technology",
+      "publish_time": "2021-09-01 07:01:28",
+      "url": "%s",
+      "title": "An article",
+      "description": "An article description",
+      "content_type": "article",
+      "publisher_id": "111",
+      "publisher_name": "Test Publisher 1",
+      "creative_instance_id": "",
+      "url_hash": "523b9f2091474c2a082c06ec17965f8c2392f871917407228bbeb51d8a55d6be",
+      "padded_img": "https://pcdn.brave.com/brave-today/cache/052e832456e00a3cee51c68eee206fe71c32cba35d5e53dee2777dd132e01364.jpg.pad",
+      "score": 13.93160989810695
+    }
+  ])",
+                            article_url.c_str());
+}
+
+std::string GetExpectedHash(const std::string& feed_json) {
+  Publishers publishers;
+  EXPECT_TRUE(ParsePublisherList(kPublishersJson, &publishers));
+  mojom::Feed feed;
+  EXPECT_TRUE(BuildFeed(feed_json, {}, &publishers, &feed));
+  return feed.hash;
+}
+
+}  // namespace
+
+class BraveNewsFeedControllerTest : public testing::Test {
+ public:
+  BraveNewsFeedControllerTest()
+      : shared_url_loader_factory_(
+            base::MakeRefCounted<network::WeakWrapperSharedURLLoaderFactory>(
+                &url_loader_factory_)),
+        api_request_helper_(TRAFFIC_ANNOTATION_FOR_TESTS,
+                            shared_url_loader_factory_) {}
+
+  void SetUp() override {
+    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
+    history_service_ =
+        history::CreateHistoryService(temp_dir_.GetPath(), true);
+    ASSERT_TRUE(history_service_);
+    prefs_.registry()->RegisterDictionaryPref(prefs::kBraveTodaySources);
+    publishers_controller_ =
+        std::make_unique<PublishersController>(&prefs_, &api_request_helper_);
+    feed_controller_ = std::make_unique<FeedController>(
+        publishers_controller_.get(), history_service_.get(),
+        &api_request_helper_);
+  }
+
+  void TearDown() override {
+    feed_controller_.reset();
+    publishers_controller_.reset();
+    history::BlockUntilHistoryProcessesPendingRequests(history_service_.get());
+    history_service_.reset();
+  }
+
+  // Serves the publishers list, and each feed request with the next body from
+  // |feed_bodies|.
+  void SetFeedResponses(std::vector<std::string> feed_bodies) {
+    const std::string base_url = "https://" + brave_today::GetHostname();
+    const std::string region = brave_today::GetRegionUrlPart();
+    const GURL sources_url(base_url + "/sources." + region + "json");
+    const GURL feed_url(base_url + "/brave-today/feed." + region + "json");
+    url_loader_factory_.SetInterceptor(base::BindLambdaForTesting(
+        [&, sources_url, feed_url,
+         feed_bodies](const network::ResourceRequest& request) {
+          url_loader_factory_.ClearResponses();
+          if (request.url == sources_url) {
+            url_loader_factory_.AddResponse(request.url.spec(),
+                                            kPublishersJson);
+          } else if (request.url == feed_url) {
+            ASSERT_LT(feed_requests_, feed_bodies.size());
+            url_loader_factory_.AddResponse(request.url.spec(),
+                                            feed_bodies[feed_requests_++]);
+          }
+        }));
+  }
+
+  mojom::FeedPtr GetOrFetchFeed() {
+    mojom::FeedPtr result;
+    base::RunLoop run_loop;
+    feed_controller_->GetOrFetchFeed(
+        base::BindLambdaForTesting([&](mojom::FeedPtr feed) {
+          result = std::move(feed);
+          run_loop.Quit();
+        }));
+    run_loop.Run();
+    return result;
+  }
+
+ protected:
+  content::BrowserTaskEnvironment task_environment_;
+  network::TestURLLoaderFactory url_loader_factory_;
+  scoped_refptr<network::SharedURLLoaderFactory> shared_url_loader_factory_;
+  api_request_helper::APIRequestHelper api_request_helper_;
+  base::ScopedTempDir temp_dir_;
+  TestingPrefServiceSimple prefs_;
+  std::unique_ptr<history::HistoryService> history_service_;
+  std::unique_ptr<PublishersController> publishers_controller_;
+  std::unique_ptr<FeedController> feed_controller_;
+  size_t feed_requests_ = 0;
+};
+
+TEST_F(BraveNewsFeedControllerTest, BuildsFeedOnWorker) {
+  const std::string feed_json = GetFeedJson("https://www.example.com/a/");
+  SetFeedResponses({feed_json});
+
+  mojom::FeedPtr feed = GetOrFetchFeed();
+  ASSERT_TRUE(feed);
+  EXPECT_EQ(feed->hash, GetExpectedHash(feed_json));
+  EXPECT_EQ(feed_requests_, 1u);
+
+  // The built feed is cached in memory.
+  feed = GetOrFetchFeed();
+  ASSERT_TRUE(feed);
+  EXPECT_EQ(feed_requests_, 1u);
+}
+
+TEST_F(BraveNewsFeedControllerTest, ClearCacheDuringUpdateDiscardsBuiltFeed) {
+  const std::string stale_feed_json =
+      GetFeedJson("https://www.example.com/stale/");
+  const std::string fresh_feed_json =
+      GetFeedJson("https://www.example.com/fresh/");
+  SetFeedResponses({stale_feed_json, fresh_feed_json});
+
+  mojom::FeedPtr result;
+  base::RunLoop run_loop;
+  feed_controller_->GetOrFetchFeed(
+      base::BindLambdaForTesting([&](mojom::FeedPtr feed) {
+        result = std::move(feed);
+        run_loop.Quit();
+      }));
+  // The update is now in flight; its feed is only built on the worker after
+  // the publishers and history replies, so it must not be cached once built.
+  feed_controller_->ClearCache();
+  run_loop.Run();
+
+  ASSERT_TRUE(result);
+  EXPECT_EQ(feed_requests_, 2u);
+  EXPECT_EQ(result->hash, GetExpectedHash(fresh_feed_json));
+  EXPECT_NE(result->hash, GetExpectedHash(stale_feed_json));
+}
+
+}  // namespace brave_news
@@ -8,6 +8,7 @@
 #include <algorithm>
 #include <utility>
 
+#include "base/strings/string_util.h"
 #include "base/strings/stringprintf.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_constants.h"
 
@@ -35,6 +36,23 @@ void ERCTokenRegistry::Bind(
 void ERCTokenRegistry::UpdateTokenList(
     std::vector<mojom::ERCTokenPtr> erc_tokens) {
   erc_tokens_ = std::move(erc_tokens);
+  BuildIndexes();
+}
+
+void ERCTokenRegistry::BuildIndexes() {
+  std::vector<std::pair<std::string, size_t>> contracts;
+  std::vector<std::pair<std::string, size_t>> symbols;
+  contracts.reserve(erc_tokens_.size());
+  symbols.reserve(erc_tokens_.size());
+  for (size_t i = 0; i < erc_tokens_.size(); ++i) {
+    const mojom::ERCTokenPtr& token = erc_tokens_[i];
+    contracts.emplace_back(base::ToLowerASCII(token->contract_address), i);
+    symbols.emplace_back(base::ToLowerASCII(token->symbol), i);
+  }
+  // flat_map keeps the first of duplicate keys, matching the first token in
+  // list order.
+  contract_index_ = base::flat_map<std::string, size_t>(std::move(contracts));
+  symbol_index_ = base::flat_map<std::string, size_t>(std::move(symbols));
 }
 
 void ERCTokenRegistry::GetTokenByContract(const std::string& contract,
@@ -44,27 +62,21 @@ void ERCTokenRegistry::GetTokenByContract(const std::string& contract,
 
 mojom::ERCTokenPtr ERCTokenRegistry::GetTokenByContract(
     const std::string& contract) {
-  auto token_it =
-      std::find_if(erc_tokens_.begin(), erc_tokens_.end(),
-                   [&](const mojom::ERCTokenPtr& current_token) {
-                     return current_token->contract_address == contract;
-                   });
-  return token_it == erc_tokens_.end() ? nullptr : token_it->Clone();
+  auto it = contract_index_.find(base::ToLowerASCII(contract));
+  if (it == contract_index_.end())
+    return nullptr;
+  return erc_tokens_[it->second].Clone();
 }
 
 void ERCTokenRegistry::GetTokenBySymbol(const std::string& symbol,
                                         GetTokenBySymbolCallback callback) {
-  auto token_it = std::find_if(erc_tokens_.begin(), erc_tokens_.end(),
-                               [&](const mojom::ERCTokenPtr& current_token) {
-                                 return current_token->symbol == symbol;
-                               });
-
-  if (token_it == erc_tokens_.end()) {
+  auto it = symbol_index_.find(base::ToLowerASCII(symbol));
+  if (it == symbol_index_.end()) {
     std::move(callback).Run(nullptr);
     return;
   }
 
-  std::move(callback).Run(token_it->Clone());
+  std::move(callback).Run(erc_tokens_[it->second].Clone());
 }
 
 void ERCTokenRegistry::GetAllTokens(GetAllTokensCallback callback) {
@@ -9,6 +9,7 @@
 #include <string>
 #include <vector>
 
+#include "base/containers/flat_map.h"
 #include "base/macros.h"
 #include "base/memory/singleton.h"
 #include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
@@ -52,6 +53,13 @@ class ERCTokenRegistry : public mojom::ERCTokenRegistry {
   ERCTokenRegistry();
 
  private:
+  void BuildIndexes();
+
+  // Lower-cased contract addresses and symbols mapped to the position of the
+  // first token in |erc_tokens_| that has them.
+  base::flat_map<std::string, size_t> contract_index_;
+  base::flat_map<std::string, size_t> symbol_index_;
+
   mojo::ReceiverSet<mojom::ERCTokenRegistry> receivers_;
 };
 
@@ -7,6 +7,8 @@
 #include <utility>
 #include <vector>
 
+#include "base/strings/string_number_conversions.h"
+#include "base/strings/stringprintf.h"
 #include "base/test/bind.h"
 #include "brave/components/brave_wallet/browser/erc_token_list_parser.h"
 #include "brave/components/brave_wallet/browser/erc_token_registry.h"
@@ -117,4 +119,49 @@ TEST(ERCTokenRegistryUnitTest, GetTokenBySymbol) {
       base::BindOnce([](mojom::ERCTokenPtr token) { ASSERT_FALSE(token); }));
 }
 
+TEST(ERCTokenRegistryUnitTest, LookupsIgnoreCase) {
+  auto* registry = ERCTokenRegistry::GetInstance();
+  std::vector<mojom::ERCTokenPtr> input_erc_tokens;
+  ASSERT_TRUE(ParseTokenList(token_list_json, &input_erc_tokens));
+  registry->UpdateTokenList(std::move(input_erc_tokens));
+
+  mojom::ERCTokenPtr token = registry->GetTokenByContract(
+      "0x0d8775f648430679a709e98d2b0cb6250d2887ef");
+  ASSERT_TRUE(token);
+  EXPECT_EQ(token->symbol, "BAT");
+
+  registry->GetTokenBySymbol(
+      "uni", base::BindOnce([](mojom::ERCTokenPtr token) {
+        ASSERT_TRUE(token);
+        EXPECT_EQ(token->contract_address,
+                  "0x1f9840a85d5aF5bf1D1762F925BDADdC4201F984");
+      }));
+}
+
+TEST(ERCTokenRegistryUnitTest, LargeTokenList) {
+  auto* registry = ERCTokenRegistry::GetInstance();
+  std::vector<mojom::ERCTokenPtr> input_erc_tokens;
+  for (int i = 0; i < 10000; ++i) {
+    auto token = mojom::ERCToken::New();
+    token->contract_address = base::StringPrintf("0x%040x", i);
+    token->name = "Token " + base::NumberToString(i);
+    token->symbol = "TKN" + base::NumberToString(i);
+    token->is_erc20 = true;
+    token->decimals = 18;
+    input_erc_tokens.push_back(std::move(token));
+  }
+  registry->UpdateTokenList(std::move(input_erc_tokens));
+
+  mojom::ERCTokenPtr token =
+      registry->GetTokenByContract(base::StringPrintf("0x%040x", 9999));
+  ASSERT_TRUE(token);
+  EXPECT_EQ(token->symbol, "TKN9999");
+
+  registry->GetTokenBySymbol(
+      "tkn5000", base::BindOnce([](mojom::ERCTokenPtr token) {
+        ASSERT_TRUE(token);
+        EXPECT_EQ(token->contract_address, base::StringPrintf("0x%040x", 5000));
+      }));
+}
+
 }  // namespace brave_wallet
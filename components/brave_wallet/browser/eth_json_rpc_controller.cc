@@ -5,12 +5,18 @@
 
 #include "brave/components/brave_wallet/browser/eth_json_rpc_controller.h"
 
+#include <map>
 #include <utility>
 
 #include "base/bind.h"
+#include "base/containers/flat_set.h"
 #include "base/environment.h"
+#include "base/feature_list.h"
+#include "base/json/json_reader.h"
+#include "base/json/json_writer.h"
 #include "base/no_destructor.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/threading/sequenced_task_runner_handle.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_prefs.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_utils.h"
 #include "brave/components/brave_wallet/browser/eth_data_builder.h"
@@ -19,6 +25,7 @@
 #include "brave/components/brave_wallet/browser/pref_names.h"
 #include "brave/components/brave_wallet/common/eth_address.h"
 #include "brave/components/brave_wallet/common/eth_request_helper.h"
+#include "brave/components/brave_wallet/common/features.h"
 #include "brave/components/brave_wallet/common/hex_utils.h"
 #include "brave/components/brave_wallet/common/value_conversion_utils.h"
 #include "brave/components/brave_wallet/common/web3_provider_constants.h"
@@ -62,6 +69,23 @@ net::NetworkTrafficAnnotationTag GetNetworkTrafficAnnotationTag() {
     )");
 }
 
+// Read-only methods which can safely be sent as part of a batch, and sent
+// again on their own if the batch fails.
+bool IsBatchableRequest(const std::string& json_payload) {
+  std::string method;
+  if (!brave_wallet::GetEthJsonRequestInfo(json_payload, nullptr, &method,
+                                           nullptr)) {
+    return false;
+  }
+
+  static const base::NoDestructor<base::flat_set<std::string>>
+      kBatchableMethods(base::flat_set<std::string>{
+          brave_wallet::kEthBlockNumber, "eth_call", "eth_estimateGas",
+          "eth_gasPrice", "eth_getBalance", brave_wallet::kEthGetBlockByNumber,
+          "eth_getTransactionCount", "eth_getTransactionReceipt"});
+  return kBatchableMethods->contains(method);
+}
+
 }  // namespace
 
 namespace brave_wallet {
@@ -120,6 +144,34 @@ void EthJsonRpcController::RequestInternal(const std::string& json_payload,
                                            RequestCallback callback) {
   DCHECK(network_url.is_valid());
 
+  if (!base::FeatureList::IsEnabled(
+          features::kBraveWalletJsonRpcBatchingFeature) ||
+      !IsBatchableRequest(json_payload)) {
+    SendRequest(json_payload, auto_retry_on_network_change, network_url,
+                std::move(callback));
+    return;
+  }
+
+  if (pending_batch_calls_.empty()) {
+    base::SequencedTaskRunnerHandle::Get()->PostTask(
+        FROM_HERE, base::BindOnce(&EthJsonRpcController::FlushBatchCalls,
+                                  weak_ptr_factory_.GetWeakPtr()));
+  }
+
+  PendingBatchCall call;
+  call.json_payload = json_payload;
+  call.auto_retry_on_network_change = auto_retry_on_network_change;
+  call.network_url = network_url;
+  call.callback = std::move(callback);
+  pending_batch_calls_.push_back(std::move(call));
+}
+
+void EthJsonRpcController::SendRequest(const std::string& json_payload,
+                                       bool auto_retry_on_network_change,
+                                       const GURL& network_url,
+                                       RequestCallback callback) {
+  DCHECK(network_url.is_valid());
+
   base::flat_map<std::string, std::string> request_headers;
   std::string id, method, params;
   if (GetEthJsonRequestInfo(json_payload, nullptr, &method, &params)) {
@@ -145,6 +197,102 @@ void EthJsonRpcController::RequestInternal(const std::string& json_payload,
                                std::move(callback), request_headers);
 }
 
+EthJsonRpcController::PendingBatchCall::PendingBatchCall() = default;
+EthJsonRpcController::PendingBatchCall::PendingBatchCall(PendingBatchCall&&) =
+    default;
+EthJsonRpcController::PendingBatchCall&
+EthJsonRpcController::PendingBatchCall::operator=(PendingBatchCall&&) =
+    default;
+EthJsonRpcController::PendingBatchCall::~PendingBatchCall() = default;
+
+void EthJsonRpcController::FlushBatchCalls() {
+  std::map<GURL, std::vector<PendingBatchCall>> calls_by_network;
+  for (auto& call : pending_batch_calls_)
+    calls_by_network[call.network_url].push_back(std::move(call));
+  pending_batch_calls_.clear();
+
+  for (auto& network_calls : calls_by_network) {
+    std::vector<PendingBatchCall>& calls = network_calls.second;
+    if (calls.size() == 1) {
+      SendRequest(calls[0].json_payload, calls[0].auto_retry_on_network_change,
+                  calls[0].network_url, std::move(calls[0].callback));
+      continue;
+    }
+
+    // Calls are renumbered by their position in the batch, since callers
+    // usually all use the same id.
+    base::Value batch(base::Value::Type::LIST);
+    bool auto_retry_on_network_change = true;
+    for (size_t i = 0; i < calls.size(); ++i) {
+      absl::optional<base::Value> request =
+          base::JSONReader::Read(calls[i].json_payload);
+      DCHECK(request && request->is_dict());
+      request->SetIntKey("id", static_cast<int>(i));
+      batch.Append(std::move(*request));
+      auto_retry_on_network_change &= calls[i].auto_retry_on_network_change;
+    }
+
+    std::string json_payload;
+    base::JSONWriter::Write(batch, &json_payload);
+    const GURL network_url = network_calls.first;
+    SendRequest(json_payload, auto_retry_on_network_change, network_url,
+                base::BindOnce(&EthJsonRpcController::OnBatchResponse,
+                               weak_ptr_factory_.GetWeakPtr(),
+                               std::move(calls)));
+  }
+}
+
+void EthJsonRpcController::OnBatchResponse(
+    std::vector<PendingBatchCall> calls,
+    const int status,
+    const std::string& body,
+    const base::flat_map<std::string, std::string>& headers) {
+  // HTTP errors such as 429 or 503 apply to every call in the batch, so
+  // each caller gets the error rather than a retry per call.
+  if (status < 200 || status > 299) {
+    for (auto& call : calls)
+      std::move(call.callback).Run(status, body, headers);
+    return;
+  }
+
+  absl::optional<base::Value> batch = base::JSONReader::Read(body);
+  if (!batch || !batch->is_list()) {
+    // The endpoint does not support batches, send each call on its own.
+    for (auto& call : calls) {
+      SendRequest(call.json_payload, call.auto_retry_on_network_change,
+                  call.network_url, std::move(call.callback));
+    }
+    return;
+  }
+
+  std::vector<absl::optional<base::Value>> responses(calls.size());
+  for (auto& response : batch->GetList()) {
+    if (!response.is_dict())
+      continue;
+    const absl::optional<int> id = response.FindIntKey("id");
+    if (!id || *id < 0 || static_cast<size_t>(*id) >= calls.size())
+      continue;
+    responses[*id] = std::move(response);
+  }
+
+  for (size_t i = 0; i < calls.size(); ++i) {
+    PendingBatchCall& call = calls[i];
+    if (!responses[i]) {
+      // The batch had no response for this call, which callers report as a
+      // parsing error.
+      std::move(call.callback).Run(status, "", headers);
+      continue;
+    }
+
+    base::Value id;
+    GetEthJsonRequestInfo(call.json_payload, &id, nullptr, nullptr);
+    responses[i]->SetKey("id", std::move(id));
+    std::string response_body;
+    base::JSONWriter::Write(*responses[i], &response_body);
+    std::move(call.callback).Run(status, response_body, headers);
+  }
+}
+
 void EthJsonRpcController::FirePendingRequestCompleted(
     const std::string& chain_id,
     const std::string& error) {
@@ -327,6 +327,31 @@ class EthJsonRpcController : public KeyedService,
                        bool auto_retry_on_network_change,
                        const GURL& network_url,
                        RequestCallback callback);
+  void SendRequest(const std::string& json_payload,
+                   bool auto_retry_on_network_change,
+                   const GURL& network_url,
+                   RequestCallback callback);
+
+  // A read-only JSON-RPC call waiting to be sent as part of a batch.
+  struct PendingBatchCall {
+    PendingBatchCall();
+    PendingBatchCall(PendingBatchCall&&);
+    PendingBatchCall& operator=(PendingBatchCall&&);
+    ~PendingBatchCall();
+
+    std::string json_payload;
+    bool auto_retry_on_network_change = false;
+    GURL network_url;
+    RequestCallback callback;
+  };
+
+  // Sends all calls queued while the current task ran, one JSON-RPC batch
+  // per network.
+  void FlushBatchCalls();
+  void OnBatchResponse(std::vector<PendingBatchCall> calls,
+                       const int status,
+                       const std::string& body,
+                       const base::flat_map<std::string, std::string>& headers);
 
   FRIEND_TEST_ALL_PREFIXES(EthJsonRpcControllerUnitTest, IsValidDomain);
   FRIEND_TEST_ALL_PREFIXES(EthJsonRpcControllerUnitTest, Reset);
@@ -362,6 +387,7 @@ class EthJsonRpcController : public KeyedService,
   mojo::RemoteSet<mojom::EthJsonRpcControllerObserver> observers_;
 
   mojo::ReceiverSet<mojom::EthJsonRpcController> receivers_;
+  std::vector<PendingBatchCall> pending_batch_calls_;
   PrefService* prefs_ = nullptr;
   base::WeakPtrFactory<EthJsonRpcController> weak_ptr_factory_;
 };
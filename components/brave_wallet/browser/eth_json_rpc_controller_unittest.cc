@@ -8,7 +8,9 @@
 #include <vector>
 
 #include "base/callback.h"
+#include "base/strings/string_util.h"
 #include "base/test/bind.h"
+#include "base/test/scoped_feature_list.h"
 #include "base/test/task_environment.h"
 #include "base/values.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_constants.h"
@@ -18,6 +20,7 @@
 #include "brave/components/brave_wallet/browser/keyring_controller.h"
 #include "brave/components/brave_wallet/browser/pref_names.h"
 #include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
+#include "brave/components/brave_wallet/common/features.h"
 #include "brave/components/brave_wallet/common/hash_utils.h"
 #include "brave/components/brave_wallet/common/value_conversion_utils.h"
 #include "brave/components/ipfs/ipfs_utils.h"
@@ -310,6 +313,32 @@ class EthJsonRpcControllerUnitTest : public testing::Test {
         }));
   }
 
+  // Answers batched requests with |batch_content| and |batch_status|, and
+  // single requests with |content|, counting how many requests reached the
+  // network.
+  void SetBatchInterceptor(
+      const std::string& batch_content,
+      const std::string& content,
+      int* request_count,
+      net::HttpStatusCode batch_status = net::HTTP_OK) {
+    url_loader_factory_.SetInterceptor(base::BindLambdaForTesting(
+        [&, batch_content, content, request_count,
+         batch_status](const network::ResourceRequest& request) {
+          ++*request_count;
+          base::StringPiece request_string(request.request_body->elements()
+                                               ->at(0)
+                                               .As<network::DataElementBytes>()
+                                               .AsStringPiece());
+          url_loader_factory_.ClearResponses();
+          if (base::StartsWith(request_string, "[")) {
+            url_loader_factory_.AddResponse(request.url.spec(), batch_content,
+                                            batch_status);
+          } else {
+            url_loader_factory_.AddResponse(request.url.spec(), content);
+          }
+        }));
+  }
+
   void SetInvalidJsonInterceptor() {
     url_loader_factory_.SetInterceptor(base::BindLambdaForTesting(
         [&](const network::ResourceRequest& request) {
@@ -812,6 +841,89 @@ TEST_F(EthJsonRpcControllerUnitTest, GetBalance) {
   EXPECT_TRUE(callback_called);
 }
 
+TEST_F(EthJsonRpcControllerUnitTest, BatchedRequests) {
+  base::test::ScopedFeatureList feature_list;
+  feature_list.InitAndEnableFeature(
+      features::kBraveWalletJsonRpcBatchingFeature);
+
+  int request_count = 0;
+  SetBatchInterceptor(
+      "[{\"jsonrpc\":\"2.0\",\"id\":1,\"result\":\"0x2\"},"
+      "{\"jsonrpc\":\"2.0\",\"id\":0,\"result\":\"0x1\"}]",
+      "", &request_count);
+
+  bool callback_called = false;
+  bool callback2_called = false;
+  rpc_controller_->GetBalance(
+      "0x4e02f254184E904300e0775E4b8eeCB1",
+      base::BindOnce(&OnStringResponse, &callback_called,
+                     mojom::ProviderError::kSuccess, "", "0x1"));
+  rpc_controller_->GetBalance(
+      "0x983110309620D911731Ac0932219af06091b6744",
+      base::BindOnce(&OnStringResponse, &callback2_called,
+                     mojom::ProviderError::kSuccess, "", "0x2"));
+  base::RunLoop().RunUntilIdle();
+  EXPECT_TRUE(callback_called);
+  EXPECT_TRUE(callback2_called);
+  EXPECT_EQ(request_count, 1);
+}
+
+TEST_F(EthJsonRpcControllerUnitTest, BatchedRequestsFallback) {
+  base::test::ScopedFeatureList feature_list;
+  feature_list.InitAndEnableFeature(
+      features::kBraveWalletJsonRpcBatchingFeature);
+
+  // Endpoints which do not understand batches get each call on its own.
+  int request_count = 0;
+  SetBatchInterceptor("Answer is 42",
+                      "{\"jsonrpc\":\"2.0\",\"id\":1,\"result\":\"0xb539d5\"}",
+                      &request_count);
+
+  bool callback_called = false;
+  bool callback2_called = false;
+  rpc_controller_->GetBalance(
+      "0x4e02f254184E904300e0775E4b8eeCB1",
+      base::BindOnce(&OnStringResponse, &callback_called,
+                     mojom::ProviderError::kSuccess, "", "0xb539d5"));
+  rpc_controller_->GetBalance(
+      "0x983110309620D911731Ac0932219af06091b6744",
+      base::BindOnce(&OnStringResponse, &callback2_called,
+                     mojom::ProviderError::kSuccess, "", "0xb539d5"));
+  base::RunLoop().RunUntilIdle();
+  EXPECT_TRUE(callback_called);
+  EXPECT_TRUE(callback2_called);
+  EXPECT_EQ(request_count, 3);
+}
+
+TEST_F(EthJsonRpcControllerUnitTest, BatchedRequestsHTTPError) {
+  base::test::ScopedFeatureList feature_list;
+  feature_list.InitAndEnableFeature(
+      features::kBraveWalletJsonRpcBatchingFeature);
+
+  // A rate limited batch is reported to every caller, not retried per call.
+  int request_count = 0;
+  SetBatchInterceptor("",
+                      "{\"jsonrpc\":\"2.0\",\"id\":1,\"result\":\"0x1\"}",
+                      &request_count, net::HTTP_TOO_MANY_REQUESTS);
+
+  bool callback_called = false;
+  bool callback2_called = false;
+  rpc_controller_->GetBalance(
+      "0x4e02f254184E904300e0775E4b8eeCB1",
+      base::BindOnce(&OnStringResponse, &callback_called,
+                     mojom::ProviderError::kInternalError,
+                     l10n_util::GetStringUTF8(IDS_WALLET_INTERNAL_ERROR), ""));
+  rpc_controller_->GetBalance(
+      "0x983110309620D911731Ac0932219af06091b6744",
+      base::BindOnce(&OnStringResponse, &callback2_called,
+                     mojom::ProviderError::kInternalError,
+                     l10n_util::GetStringUTF8(IDS_WALLET_INTERNAL_ERROR), ""));
+  base::RunLoop().RunUntilIdle();
+  EXPECT_TRUE(callback_called);
+  EXPECT_TRUE(callback2_called);
+  EXPECT_EQ(request_count, 1);
+}
+
 TEST_F(EthJsonRpcControllerUnitTest, GetERC20TokenBalance) {
   bool callback_called = false;
   SetInterceptor(
@@ -7,6 +7,9 @@
 
 #include <utility>
 
+#include "base/auto_reset.h"
+#include "base/bind.h"
+#include "base/containers/contains.h"
 #include "base/guid.h"
 #include "base/json/values_util.h"
 #include "base/logging.h"
@@ -28,6 +31,37 @@ namespace brave_wallet {
 namespace {
 constexpr size_t kMaxConfirmedTxNum = 10;
 constexpr size_t kMaxRejectedTxNum = 10;
+
+std::unique_ptr<EthTransaction> CloneTransaction(const EthTransaction& tx) {
+  switch (tx.type()) {
+    case 1:
+      // When type is 1 it's always Eip2930Transaction
+      return std::make_unique<Eip2930Transaction>(
+          static_cast<const Eip2930Transaction&>(tx));
+    case 2:
+      // When type is 2 it's always Eip1559Transaction
+      return std::make_unique<Eip1559Transaction>(
+          static_cast<const Eip1559Transaction&>(tx));
+    default:
+      return std::make_unique<EthTransaction>(tx);
+  }
+}
+
+std::unique_ptr<EthTxStateManager::TxMeta> CloneTxMeta(
+    const EthTxStateManager::TxMeta& meta) {
+  auto clone = std::make_unique<EthTxStateManager::TxMeta>(
+      CloneTransaction(*meta.tx));
+  clone->id = meta.id;
+  clone->status = meta.status;
+  clone->from = meta.from;
+  clone->created_time = meta.created_time;
+  clone->submitted_time = meta.submitted_time;
+  clone->confirmed_time = meta.confirmed_time;
+  clone->tx_receipt = meta.tx_receipt;
+  clone->tx_hash = meta.tx_hash;
+  return clone;
+}
+
 }  // namespace
 
 EthTxStateManager::EthTxStateManager(PrefService* prefs,
@@ -37,9 +71,20 @@ EthTxStateManager::EthTxStateManager(PrefService* prefs,
   rpc_controller_->AddObserver(observer_receiver_.BindNewPipeAndPassRemote());
   chain_id_ = rpc_controller_->GetChainId();
   network_url_ = rpc_controller_->GetNetworkUrl();
+  pref_change_registrar_.Init(prefs_);
+  pref_change_registrar_.Add(
+      kBraveWalletTransactions,
+      base::BindRepeating(&EthTxStateManager::OnTransactionsPrefChanged,
+                          base::Unretained(this)));
 }
 EthTxStateManager::~EthTxStateManager() = default;
 
+EthTxStateManager::TxCache::TxCache() = default;
+EthTxStateManager::TxCache::TxCache(TxCache&&) = default;
+EthTxStateManager::TxCache& EthTxStateManager::TxCache::operator=(TxCache&&) =
+    default;
+EthTxStateManager::TxCache::~TxCache() = default;
+
 EthTxStateManager::TxMeta::TxMeta() : tx(std::make_unique<EthTransaction>()) {}
 EthTxStateManager::TxMeta::TxMeta(std::unique_ptr<EthTransaction> tx_in)
     : tx(std::move(tx_in)) {}
@@ -223,11 +268,16 @@ std::unique_ptr<EthTxStateManager::TxMeta> EthTxStateManager::ValueToTxMeta(
 }
 
 void EthTxStateManager::AddOrUpdateTx(const TxMeta& meta) {
-  DictionaryPrefUpdate update(prefs_, kBraveWalletTransactions);
-  base::DictionaryValue* dict = update.Get();
-  const std::string path = GetNetworkId(prefs_, chain_id_) + "." + meta.id;
-  bool is_add = dict->FindPath(path) == nullptr;
-  dict->SetPath(path, TxMetaToValue(meta));
+  TxCache& cache = GetTxCache();
+  bool is_add = !base::Contains(cache.txs_by_id, meta.id);
+  {
+    base::AutoReset<bool> updating(&is_updating_prefs_, true);
+    DictionaryPrefUpdate update(prefs_, kBraveWalletTransactions);
+    base::DictionaryValue* dict = update.Get();
+    const std::string path = GetNetworkId(prefs_, chain_id_) + "." + meta.id;
+    dict->SetPath(path, TxMetaToValue(meta));
+  }
+  CacheTx(&cache, CloneTxMeta(meta));
   if (!is_add) {
     for (auto& observer : observers_)
       observer.OnTransactionStatusChanged(TxMetaToTransactionInfo(meta));
@@ -244,26 +294,27 @@ void EthTxStateManager::AddOrUpdateTx(const TxMeta& meta) {
 
 std::unique_ptr<EthTxStateManager::TxMeta> EthTxStateManager::GetTx(
     const std::string& id) {
-  const base::DictionaryValue* dict =
-      prefs_->GetDictionary(kBraveWalletTransactions);
-  if (!dict)
-    return nullptr;
-  const base::Value* value =
-      dict->FindPath(GetNetworkId(prefs_, chain_id_) + "." + id);
-  if (!value)
+  const TxCache& cache = GetTxCache();
+  auto it = cache.txs_by_id.find(id);
+  if (it == cache.txs_by_id.end())
     return nullptr;
 
-  return ValueToTxMeta(*value);
+  return CloneTxMeta(*it->second);
 }
 
 void EthTxStateManager::DeleteTx(const std::string& id) {
-  DictionaryPrefUpdate update(prefs_, kBraveWalletTransactions);
-  base::DictionaryValue* dict = update.Get();
-  dict->RemovePath(GetNetworkId(prefs_, chain_id_) + "." + id);
+  {
+    base::AutoReset<bool> updating(&is_updating_prefs_, true);
+    DictionaryPrefUpdate update(prefs_, kBraveWalletTransactions);
+    base::DictionaryValue* dict = update.Get();
+    dict->RemovePath(GetNetworkId(prefs_, chain_id_) + "." + id);
+  }
+  UncacheTx(&GetTxCache(), id);
 }
 
 void EthTxStateManager::WipeTxs() {
   prefs_->ClearPref(kBraveWalletTransactions);
+  tx_caches_.clear();
 }
 
 std::vector<std::unique_ptr<EthTxStateManager::TxMeta>>
@@ -271,25 +322,90 @@ EthTxStateManager::GetTransactionsByStatus(
     absl::optional<mojom::TransactionStatus> status,
     absl::optional<EthAddress> from) {
   std::vector<std::unique_ptr<EthTxStateManager::TxMeta>> result;
+  const TxCache& cache = GetTxCache();
+  if (!status.has_value() && !from.has_value()) {
+    for (const auto& it : cache.txs_by_id)
+      result.push_back(CloneTxMeta(*it.second));
+    return result;
+  }
+
+  const std::set<std::string>* status_ids = nullptr;
+  if (status.has_value()) {
+    auto it = cache.ids_by_status.find(*status);
+    if (it == cache.ids_by_status.end())
+      return result;
+    status_ids = &it->second;
+  }
+  const std::set<std::string>* from_ids = nullptr;
+  if (from.has_value()) {
+    auto it = cache.ids_by_from.find(from->ToHex());
+    if (it == cache.ids_by_from.end())
+      return result;
+    from_ids = &it->second;
+  }
+
+  // Walk the smaller of the two id sets and check membership in the other.
+  const std::set<std::string>* ids = status_ids ? status_ids : from_ids;
+  const std::set<std::string>* filter = status_ids ? from_ids : nullptr;
+  if (filter && filter->size() < ids->size())
+    std::swap(ids, filter);
+  for (const auto& id : *ids) {
+    if (filter && !filter->count(id))
+      continue;
+    result.push_back(CloneTxMeta(*cache.txs_by_id.at(id)));
+  }
+  return result;
+}
+
+EthTxStateManager::TxCache& EthTxStateManager::GetTxCache() {
+  const std::string network_id = GetNetworkId(prefs_, chain_id_);
+  auto it = tx_caches_.find(network_id);
+  if (it != tx_caches_.end())
+    return it->second;
+
+  TxCache& cache = tx_caches_[network_id];
   const base::DictionaryValue* dict =
       prefs_->GetDictionary(kBraveWalletTransactions);
-  const base::Value* network_dict =
-      dict->FindKey(GetNetworkId(prefs_, chain_id_));
+  const base::Value* network_dict = dict->FindKey(network_id);
   if (!network_dict)
-    return result;
+    return cache;
 
-  for (const auto it : network_dict->DictItems()) {
-    std::unique_ptr<EthTxStateManager::TxMeta> meta = ValueToTxMeta(it.second);
-    if (!meta) {
+  for (const auto item : network_dict->DictItems()) {
+    std::unique_ptr<EthTxStateManager::TxMeta> meta =
+        ValueToTxMeta(item.second);
+    if (!meta)
       continue;
-    }
-    if (!status.has_value() || meta->status == *status) {
-      if (from.has_value() && meta->from != *from)
-        continue;
-      result.push_back(std::move(meta));
-    }
+    CacheTx(&cache, std::move(meta));
   }
-  return result;
+  return cache;
+}
+
+void EthTxStateManager::CacheTx(TxCache* cache, std::unique_ptr<TxMeta> meta) {
+  UncacheTx(cache, meta->id);
+  cache->ids_by_status[meta->status].insert(meta->id);
+  cache->ids_by_from[meta->from.ToHex()].insert(meta->id);
+  const std::string id = meta->id;
+  cache->txs_by_id[id] = std::move(meta);
+}
+
+void EthTxStateManager::UncacheTx(TxCache* cache, const std::string& id) {
+  auto it = cache->txs_by_id.find(id);
+  if (it == cache->txs_by_id.end())
+    return;
+  cache->ids_by_status[it->second->status].erase(id);
+  auto from_ids = cache->ids_by_from.find(it->second->from.ToHex());
+  if (from_ids != cache->ids_by_from.end()) {
+    from_ids->second.erase(id);
+    if (from_ids->second.empty())
+      cache->ids_by_from.erase(from_ids);
+  }
+  cache->txs_by_id.erase(it);
+}
+
+void EthTxStateManager::OnTransactionsPrefChanged() {
+  if (is_updating_prefs_)
+    return;
+  tx_caches_.clear();
 }
 
 void EthTxStateManager::ChainChangedEvent(const std::string& chain_id) {
@@ -306,24 +422,28 @@ void EthTxStateManager::RetireTxByStatus(mojom::TransactionStatus status,
   if (status != mojom::TransactionStatus::Confirmed &&
       status != mojom::TransactionStatus::Rejected)
     return;
-  auto tx_metas = GetTransactionsByStatus(status, absl::nullopt);
-  if (tx_metas.size() > max_num) {
-    EthTxStateManager::TxMeta* oldest_meta = nullptr;
-    for (const auto& tx_meta : tx_metas) {
-      if (!oldest_meta) {
-        oldest_meta = tx_meta.get();
-      } else {
-        if (tx_meta->status == mojom::TransactionStatus::Confirmed &&
-            tx_meta->confirmed_time < oldest_meta->confirmed_time) {
-          oldest_meta = tx_meta.get();
-        } else if (tx_meta->status == mojom::TransactionStatus::Rejected &&
-                   tx_meta->created_time < oldest_meta->created_time) {
-          oldest_meta = tx_meta.get();
-        }
+  const TxCache& cache = GetTxCache();
+  auto ids = cache.ids_by_status.find(status);
+  if (ids == cache.ids_by_status.end() || ids->second.size() <= max_num)
+    return;
+
+  const EthTxStateManager::TxMeta* oldest_meta = nullptr;
+  for (const auto& id : ids->second) {
+    const EthTxStateManager::TxMeta* tx_meta = cache.txs_by_id.at(id).get();
+    if (!oldest_meta) {
+      oldest_meta = tx_meta;
+    } else {
+      if (tx_meta->status == mojom::TransactionStatus::Confirmed &&
+          tx_meta->confirmed_time < oldest_meta->confirmed_time) {
+        oldest_meta = tx_meta;
+      } else if (tx_meta->status == mojom::TransactionStatus::Rejected &&
+                 tx_meta->created_time < oldest_meta->created_time) {
+        oldest_meta = tx_meta;
       }
     }
-    DeleteTx(oldest_meta->id);
   }
+  // Copy the id, DeleteTx() frees |oldest_meta|.
+  DeleteTx(std::string(oldest_meta->id));
 }
 
 void EthTxStateManager::AddObserver(EthTxStateManager::Observer* observer) {
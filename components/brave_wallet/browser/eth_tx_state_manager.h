@@ -6,7 +6,9 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_ETH_TX_STATE_MANAGER_H_
 #define BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_ETH_TX_STATE_MANAGER_H_
 
+#include <map>
 #include <memory>
+#include <set>
 #include <string>
 #include <utility>
 #include <vector>
@@ -17,6 +19,7 @@
 #include "brave/components/brave_wallet/browser/eth_transaction.h"
 #include "brave/components/brave_wallet/common/brave_wallet_types.h"
 #include "brave/components/brave_wallet/common/eth_address.h"
+#include "components/prefs/pref_change_registrar.h"
 #include "third_party/abseil-cpp/absl/types/optional.h"
 
 class PrefService;
@@ -86,11 +89,38 @@ class EthTxStateManager : public mojom::EthJsonRpcControllerObserver {
   void RemoveObserver(Observer* observer);
 
  private:
+  // Decoded TxMetas of a single network, indexed by id and by status so
+  // lookups do not have to re-parse the transactions pref.
+  struct TxCache {
+    TxCache();
+    TxCache(TxCache&&);
+    TxCache& operator=(TxCache&&);
+    ~TxCache();
+
+    std::map<std::string, std::unique_ptr<TxMeta>> txs_by_id;
+    std::map<mojom::TransactionStatus, std::set<std::string>> ids_by_status;
+    // Keyed by EthAddress::ToHex() of the from address.
+    std::map<std::string, std::set<std::string>> ids_by_from;
+  };
+
+  // Returns the cache of the current network, loading it from prefs first if
+  // needed.
+  TxCache& GetTxCache();
+  void CacheTx(TxCache* cache, std::unique_ptr<TxMeta> meta);
+  void UncacheTx(TxCache* cache, const std::string& id);
+  void OnTransactionsPrefChanged();
+
   // only support REJECTED and CONFIRMED
   void RetireTxByStatus(mojom::TransactionStatus status, size_t max_num);
 
   base::ObserverList<Observer> observers_;
   PrefService* prefs_;
+  PrefChangeRegistrar pref_change_registrar_;
+  // Keyed by network id.
+  std::map<std::string, TxCache> tx_caches_;
+  // Set while |this| writes the transactions pref, so that only changes made
+  // by someone else drop |tx_caches_|.
+  bool is_updating_prefs_ = false;
   EthJsonRpcController* rpc_controller_;
   mojo::Receiver<mojom::EthJsonRpcControllerObserver> observer_receiver_{this};
   std::string chain_id_;
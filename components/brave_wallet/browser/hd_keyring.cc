@@ -51,11 +51,20 @@ void HDKeyring::AddAccounts(size_t number) {
   size_t cur_accounts_number = accounts_.size();
   for (size_t i = cur_accounts_number; i < cur_accounts_number + number; ++i) {
     if (root_) {
-      accounts_.push_back(root_->DeriveChild(i));
+      // |root_| is already derived to the account level of the path, so each
+      // account costs a single child derivation.
+      AppendAccount(root_->DeriveChild(i));
     }
   }
 }
 
+void HDKeyring::AppendAccount(std::unique_ptr<HDKey> hd_key) {
+  const std::string address = GetAddressInternal(hd_key.get());
+  account_indexes_.emplace(address, accounts_.size());
+  account_addresses_.push_back(address);
+  accounts_.push_back(std::move(hd_key));
+}
+
 std::vector<std::string> HDKeyring::GetAccounts() const {
   std::vector<std::string> addresses;
   for (size_t i = 0; i < accounts_.size(); ++i) {
@@ -66,12 +75,10 @@ std::vector<std::string> HDKeyring::GetAccounts() const {
 
 absl::optional<size_t> HDKeyring::GetAccountIndex(
     const std::string& address) const {
-  for (size_t i = 0; i < accounts_.size(); ++i) {
-    if (GetAddress(i) == address) {
-      return i;
-    }
-  }
-  return absl::nullopt;
+  auto it = account_indexes_.find(address);
+  if (it == account_indexes_.end())
+    return absl::nullopt;
+  return it->second;
 }
 
 size_t HDKeyring::GetAccountsNumber() const {
@@ -80,6 +87,8 @@ size_t HDKeyring::GetAccountsNumber() const {
 
 void HDKeyring::RemoveAccount() {
   accounts_.pop_back();
+  account_indexes_.erase(account_addresses_.back());
+  account_addresses_.pop_back();
 }
 
 bool HDKeyring::AddImportedAddress(const std::string& address,
@@ -88,10 +97,8 @@ bool HDKeyring::AddImportedAddress(const std::string& address,
   if (imported_accounts_[address])
     return false;
   // Check if it is duplicate in derived accounts
-  for (size_t i = 0; i < accounts_.size(); ++i) {
-    if (GetAddress(i) == address)
-      return false;
-  }
+  if (GetAccountIndex(address))
+    return false;
 
   imported_accounts_[address] = std::move(hd_key);
   return true;
@@ -121,7 +128,7 @@ bool HDKeyring::RemoveImportedAccount(const std::string& address) {
 std::string HDKeyring::GetAddress(size_t index) const {
   if (accounts_.empty() || index >= accounts_.size())
     return std::string();
-  return GetAddressInternal(accounts_[index].get());
+  return account_addresses_[index];
 }
 
 std::string HDKeyring::GetAddressInternal(const HDKey* hd_key) const {
@@ -226,10 +233,9 @@ HDKey* HDKeyring::GetHDKeyFromAddress(const std::string& address) {
   const auto imported_accounts_iter = imported_accounts_.find(address);
   if (imported_accounts_iter != imported_accounts_.end())
     return imported_accounts_iter->second.get();
-  for (size_t i = 0; i < accounts_.size(); ++i) {
-    if (GetAddress(i) == address)
-      return accounts_[i].get();
-  }
+  const absl::optional<size_t> index = GetAccountIndex(address);
+  if (index)
+    return accounts_[*index].get();
   return nullptr;
 }
 
@@ -72,10 +72,16 @@ class HDKeyring {
   std::string GetAddressInternal(const HDKey* hd_key) const;
   bool AddImportedAddress(const std::string& address,
                           std::unique_ptr<HDKey> hd_key);
+  // Appends a derived account and caches its address.
+  void AppendAccount(std::unique_ptr<HDKey> hd_key);
 
   std::unique_ptr<HDKey> root_;
   std::unique_ptr<HDKey> master_key_;
   std::vector<std::unique_ptr<HDKey>> accounts_;
+  // Addresses of |accounts_|, computed once when the account is added.
+  std::vector<std::string> account_addresses_;
+  // (address, index in |accounts_|)
+  base::flat_map<std::string, size_t> account_indexes_;
   // (address, key)
   base::flat_map<std::string, std::unique_ptr<HDKey>> imported_accounts_;
 
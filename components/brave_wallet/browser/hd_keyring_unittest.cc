@@ -81,6 +81,29 @@ TEST(HDKeyringUnitTest, Accounts) {
   EXPECT_TRUE(keyring2.GetAddress(0).empty());
 }
 
+TEST(HDKeyringUnitTest, ManyAccounts) {
+  HDKeyring keyring;
+  std::vector<uint8_t> seed;
+  EXPECT_TRUE(base::HexStringToBytes(
+      "13ca6c28d26812f82db27908de0b0b7b18940cc4e9d96ebd7de190f706741489907ef65b"
+      "8f9e36c31dc46e81472b6a5e40a4487e725ace445b8203f243fb8958",
+      &seed));
+  keyring.ConstructRootHDKey(seed, "m/44'/60'/0'/0");
+  keyring.AddAccounts(1000);
+  std::vector<std::string> accounts = keyring.GetAccounts();
+  ASSERT_EQ(accounts.size(), 1000u);
+  EXPECT_EQ(accounts[2], "0x02e77f0e2fa06F95BDEa79Fad158477723145838");
+  for (size_t i = 0; i < accounts.size(); ++i) {
+    EXPECT_EQ(keyring.GetAccountIndex(accounts[i]), i);
+  }
+  EXPECT_TRUE(keyring.GetHDKeyFromAddress(accounts[999]));
+
+  keyring.RemoveAccount();
+  EXPECT_FALSE(keyring.GetAccountIndex(accounts[999]));
+  EXPECT_FALSE(keyring.GetHDKeyFromAddress(accounts[999]));
+  EXPECT_EQ(keyring.GetAccountIndex(accounts[998]), 998u);
+}
+
 TEST(HDKeyringUnitTest, SignTransaction) {
   // Specific signature check is in eth_transaction_unittest.cc
   HDKeyring keyring;
@@ -112,7 +135,7 @@ TEST(HDKeyringUnitTest, SignMessage) {
   key->SetPrivateKey(private_key);
 
   HDKeyring keyring;
-  keyring.accounts_.push_back(std::move(key));
+  keyring.AppendAccount(std::move(key));
   EXPECT_EQ(keyring.GetAddress(0),
             "0xbE93f9BacBcFFC8ee6663f2647917ed7A20a57BB");
 
@@ -14,6 +14,8 @@ const base::Feature kNativeBraveWalletFeature{"NativeBraveWallet",
                                               base::FEATURE_ENABLED_BY_DEFAULT};
 const base::Feature kBraveWalletFilecoinFeature{
     "BraveWalletFilecoin", base::FEATURE_DISABLED_BY_DEFAULT};
+const base::Feature kBraveWalletJsonRpcBatchingFeature{
+    "BraveWalletJsonRpcBatching", base::FEATURE_DISABLED_BY_DEFAULT};
 
 }  // namespace features
 }  // namespace brave_wallet
@@ -15,6 +15,7 @@ namespace features {
 
 extern const base::Feature kNativeBraveWalletFeature;
 extern const base::Feature kBraveWalletFilecoinFeature;
+extern const base::Feature kBraveWalletJsonRpcBatchingFeature;
 
 }  // namespace features
 }  // namespace brave_wallet
@@ -5,7 +5,11 @@
 
 #include "brave/components/debounce/browser/debounce_component_installer.h"
 
+#include <algorithm>
+#include <iterator>
+#include <map>
 #include <memory>
+#include <set>
 #include <utility>
 
 #include "base/base_paths.h"
@@ -56,29 +60,62 @@ void DebounceComponentInstaller::OnDATFileDataReady(
   }
   rules_.clear();
   host_cache_.clear();
+  rules_by_domain_.clear();
+  rules_for_any_domain_.clear();
   std::vector<std::string> hosts;
+  std::map<std::string, std::vector<size_t>> rules_by_domain;
   base::JSONValueConverter<DebounceRule> converter;
   for (base::Value& it : root->GetList()) {
     std::unique_ptr<DebounceRule> rule = std::make_unique<DebounceRule>();
     if (!converter.Convert(it, rule.get()))
       continue;
+    const size_t rule_index = rules_.size();
+    std::set<std::string> domains;
+    bool matches_any_domain = false;
     for (const URLPattern& pattern : rule->include_pattern_set()) {
+      std::string etldp1;
       if (!pattern.host().empty()) {
-        std::string etldp1 =
-            net::registry_controlled_domains::GetDomainAndRegistry(
-                pattern.host(),
-                net::registry_controlled_domains::PrivateRegistryFilter::
-                    INCLUDE_PRIVATE_REGISTRIES);
-        hosts.push_back(std::move(etldp1));
+        etldp1 = net::registry_controlled_domains::GetDomainAndRegistry(
+            pattern.host(),
+            net::registry_controlled_domains::PrivateRegistryFilter::
+                INCLUDE_PRIVATE_REGISTRIES);
+        hosts.push_back(etldp1);
       }
+      if (etldp1.empty())
+        matches_any_domain = true;
+      else
+        domains.insert(std::move(etldp1));
+    }
+    if (matches_any_domain) {
+      rules_for_any_domain_.push_back(rule_index);
+    } else {
+      for (const std::string& domain : domains)
+        rules_by_domain[domain].push_back(rule_index);
     }
     rules_.push_back(std::move(rule));
   }
   host_cache_ = std::move(hosts);
+  rules_by_domain_ = base::flat_map<std::string, std::vector<size_t>>(
+      std::make_move_iterator(rules_by_domain.begin()),
+      std::make_move_iterator(rules_by_domain.end()));
   for (Observer& observer : observers_)
     observer.OnRulesReady(this);
 }
 
+std::vector<size_t> DebounceComponentInstaller::GetRuleIndicesForDomain(
+    const std::string& etldp1) const {
+  const auto it = rules_by_domain_.find(etldp1);
+  if (it == rules_by_domain_.end())
+    return rules_for_any_domain_;
+
+  std::vector<size_t> rule_indices;
+  rule_indices.reserve(it->second.size() + rules_for_any_domain_.size());
+  std::merge(it->second.begin(), it->second.end(),
+             rules_for_any_domain_.begin(), rules_for_any_domain_.end(),
+             std::back_inserter(rule_indices));
+  return rule_indices;
+}
+
 void DebounceComponentInstaller::OnComponentReady(
     const std::string& component_id,
     const base::FilePath& install_dir,
@@ -10,6 +10,7 @@
 #include <string>
 #include <vector>
 
+#include "base/containers/flat_map.h"
 #include "base/containers/flat_set.h"
 #include "base/files/file_path.h"
 #include "base/json/json_value_converter.h"
@@ -24,6 +25,7 @@
 namespace debounce {
 
 class DebounceBrowserTest;
+class DebounceServiceTest;
 
 extern const char kDebounceConfigFile[];
 extern const char kDebounceConfigFileVersion[];
@@ -45,6 +47,10 @@ class DebounceComponentInstaller
   }
   const base::flat_set<std::string>& host_cache() const { return host_cache_; }
 
+  // Returns the indices into |rules()|, in rule order, of the rules which may
+  // match a URL with the given eTLD+1.
+  std::vector<size_t> GetRuleIndicesForDomain(const std::string& etldp1) const;
+
   // implementation of brave_component_updater::LocalDataFilesObserver
   void OnComponentReady(const std::string& component_id,
                         const base::FilePath& install_dir,
@@ -63,6 +69,8 @@ class DebounceComponentInstaller
 
  private:
   friend class DebounceBrowserTest;
+  friend class DebounceServiceTest;
+class DebounceServiceTest;
 
   void OnDATFileDataReady(const std::string& contents);
   void LoadOnTaskRunner();
@@ -71,6 +79,12 @@ class DebounceComponentInstaller
   base::ObserverList<Observer> observers_;
   std::vector<std::unique_ptr<DebounceRule>> rules_;
   base::flat_set<std::string> host_cache_;
+  // Rules keyed by the eTLD+1 of their include patterns, built when the rules
+  // are loaded so that a navigation only evaluates the rules for its site.
+  // Rules with an include pattern that has no eTLD+1, such as a wildcard host,
+  // may match any site.
+  base::flat_map<std::string, std::vector<size_t>> rules_by_domain_;
+  std::vector<size_t> rules_for_any_domain_;
   base::FilePath resource_dir_;
 
   base::WeakPtrFactory<DebounceComponentInstaller> weak_factory_{this};
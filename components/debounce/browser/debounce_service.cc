@@ -5,6 +5,7 @@
 
 #include "brave/components/debounce/browser/debounce_service.h"
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <vector>
@@ -16,6 +17,16 @@
 #include "net/base/registry_controlled_domains/registry_controlled_domain.h"
 #include "url/origin.h"
 
+namespace {
+
+std::string GetETLDP1(const GURL& url) {
+  return net::registry_controlled_domains::GetDomainAndRegistry(
+      url, net::registry_controlled_domains::PrivateRegistryFilter::
+               INCLUDE_PRIVATE_REGISTRIES);
+}
+
+}  // namespace
+
 namespace debounce {
 
 DebounceService::DebounceService(
@@ -30,10 +41,7 @@ bool DebounceService::Debounce(const GURL& original_url,
   // applied.
   const base::flat_set<std::string>& host_cache =
       component_installer_->host_cache();
-  const std::string etldp1 =
-      net::registry_controlled_domains::GetDomainAndRegistry(
-          original_url, net::registry_controlled_domains::
-                            PrivateRegistryFilter::INCLUDE_PRIVATE_REGISTRIES);
+  const std::string etldp1 = GetETLDP1(original_url);
   if (!base::Contains(host_cache, etldp1))
     return false;
 
@@ -45,14 +53,25 @@ bool DebounceService::Debounce(const GURL& original_url,
   // Debounce rules are applied in order. All rules are checked on every URL. If
   // one rule applies, the URL is changed to the debounced URL and we continue
   // to apply the rest of the rules to the new URL. Previously checked rules are
-  // not reapplied; i.e. we never restart the loop.
-  for (const std::unique_ptr<DebounceRule>& rule : rules) {
-    if (rule->Apply(current_url, final_url)) {
-      if (current_url != *final_url) {
-        changed = true;
-        current_url = *final_url;
-      }
+  // not reapplied; i.e. we never restart the loop. Only the rules indexed
+  // under the current URL's eTLD+1 can match it, so the others are skipped.
+  std::vector<size_t> rule_indices =
+      component_installer_->GetRuleIndicesForDomain(etldp1);
+  auto it = rule_indices.begin();
+  while (it != rule_indices.end()) {
+    const size_t rule_index = *it++;
+    if (!rules[rule_index]->Apply(current_url, final_url) ||
+        current_url == *final_url) {
+      continue;
     }
+    changed = true;
+    current_url = *final_url;
+    // The debounced URL may be on another site, so continue with the rules
+    // after this one which are indexed under its eTLD+1.
+    rule_indices = component_installer_->GetRuleIndicesForDomain(
+        GetETLDP1(current_url));
+    it = std::upper_bound(rule_indices.begin(), rule_indices.end(),
+                          rule_index);
   }
   return changed;
 }
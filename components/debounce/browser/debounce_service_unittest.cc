@@ -0,0 +1,135 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/debounce/browser/debounce_service.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "brave/components/brave_component_updater/browser/local_data_files_service.h"
+#include "brave/components/debounce/browser/debounce_component_installer.h"
+#include "net/base/url_util.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
+
+namespace debounce {
+
+namespace {
+
+std::string RuleJson(const std::string& include_pattern) {
+  return R"({"include": [")" + include_pattern +
+         R"("], "exclude": [], "action": "redirect", "param": "url"})";
+}
+
+std::string RulesJson(const std::vector<std::string>& include_patterns) {
+  std::string json = "[";
+  for (const std::string& include_pattern : include_patterns) {
+    if (json.size() > 1)
+      json += ",";
+    json += RuleJson(include_pattern);
+  }
+  return json + "]";
+}
+
+GURL AddRedirectParam(const std::string& url, const GURL& landing_url) {
+  return net::AppendOrReplaceQueryParameter(GURL(url), "url",
+                                            landing_url.spec());
+}
+
+}  // namespace
+
+class DebounceServiceTest : public testing::Test {
+ public:
+  DebounceServiceTest()
+      : local_data_files_service_(nullptr),
+        component_installer_(&local_data_files_service_),
+        debounce_service_(&component_installer_) {}
+
+ protected:
+  void LoadRules(const std::vector<std::string>& include_patterns) {
+    component_installer_.OnDATFileDataReady(RulesJson(include_patterns));
+    ASSERT_EQ(component_installer_.rules().size(), include_patterns.size());
+  }
+
+  std::vector<size_t> GetRuleIndicesForDomain(const std::string& etldp1) {
+    return component_installer_.GetRuleIndicesForDomain(etldp1);
+  }
+
+  // Returns the debounced URL, or an empty URL if |url| is not debounced.
+  GURL Debounce(const GURL& url) {
+    GURL final_url;
+    if (!debounce_service_.Debounce(url, &final_url))
+      return GURL();
+    return final_url;
+  }
+
+  brave_component_updater::LocalDataFilesService local_data_files_service_;
+  DebounceComponentInstaller component_installer_;
+  DebounceService debounce_service_;
+};
+
+TEST_F(DebounceServiceTest, RulesIndexedByETLDP1) {
+  LoadRules({"https://tracker.a.com/?url=*", "https://*.b.com/?url=*",
+             "https://c.com/?url=*", "https://www.a.com/?url=*"});
+
+  EXPECT_EQ(GetRuleIndicesForDomain("a.com"), (std::vector<size_t>{0, 3}));
+  EXPECT_EQ(GetRuleIndicesForDomain("b.com"), (std::vector<size_t>{1}));
+  EXPECT_EQ(GetRuleIndicesForDomain("c.com"), (std::vector<size_t>{2}));
+  EXPECT_TRUE(GetRuleIndicesForDomain("z.com").empty());
+
+  const GURL landing_url("https://z.com/");
+  EXPECT_EQ(Debounce(AddRedirectParam("https://tracker.a.com/", landing_url)),
+            landing_url);
+  EXPECT_EQ(Debounce(AddRedirectParam("https://www.a.com/", landing_url)),
+            landing_url);
+  EXPECT_EQ(Debounce(AddRedirectParam("https://sub.b.com/", landing_url)),
+            landing_url);
+  EXPECT_EQ(Debounce(AddRedirectParam("https://other.a.com/", landing_url)),
+            GURL());
+  EXPECT_EQ(Debounce(AddRedirectParam("https://y.com/", landing_url)), GURL());
+}
+
+TEST_F(DebounceServiceTest, RulesWithoutETLDP1) {
+  LoadRules({"https://a.com/?url=*", "https://*/?url=*",
+             "http://127.0.0.1/?url=*", "https://b.com/?url=*"});
+
+  // Rules without an eTLD+1 are returned for every domain, in rule order.
+  EXPECT_EQ(GetRuleIndicesForDomain("a.com"), (std::vector<size_t>{0, 1, 2}));
+  EXPECT_EQ(GetRuleIndicesForDomain("b.com"), (std::vector<size_t>{1, 2, 3}));
+  EXPECT_EQ(GetRuleIndicesForDomain("z.com"), (std::vector<size_t>{1, 2}));
+  EXPECT_EQ(GetRuleIndicesForDomain(""), (std::vector<size_t>{1, 2}));
+
+  const GURL landing_url("https://z.com/");
+  EXPECT_EQ(Debounce(AddRedirectParam("http://127.0.0.1/", landing_url)),
+            landing_url);
+  // The wildcard rule comes before the b.com rule, so it debounces b.com and
+  // is not applied again to the new site.
+  const GURL url_y = AddRedirectParam("https://y.com/", landing_url);
+  EXPECT_EQ(Debounce(AddRedirectParam("https://b.com/", url_y)), url_y);
+}
+
+TEST_F(DebounceServiceTest, MultiHopKeepsRuleOrder) {
+  LoadRules({"https://b.com/?url=*", "https://a.com/?url=*",
+             "https://c.com/?url=*", "https://b.com/?url=*"});
+
+  const GURL landing_url("https://z.com/");
+  const GURL url_c = AddRedirectParam("https://c.com/", landing_url);
+  const GURL url_b = AddRedirectParam("https://b.com/", url_c);
+  const GURL url_a = AddRedirectParam("https://a.com/", url_b);
+
+  // a.com is debounced by rule 1, then b.com by rule 3, which is indexed under
+  // the new site. Rules 0 and 2 come before rule 3 and are not applied.
+  EXPECT_EQ(Debounce(url_a), url_c);
+
+  // c.com is debounced by rule 2. The only rule for a.com comes before it.
+  const GURL url_c_to_a = AddRedirectParam("https://c.com/", url_a);
+  EXPECT_EQ(Debounce(url_c_to_a), url_a);
+
+  // b.com is debounced by rule 0, then c.com by rule 2.
+  EXPECT_EQ(Debounce(url_b), landing_url);
+}
+
+}  // namespace debounce
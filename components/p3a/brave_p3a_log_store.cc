@@ -5,6 +5,7 @@
 
 #include "brave/components/p3a/brave_p3a_log_store.h"
 
+#include "base/containers/contains.h"
 #include "base/logging.h"
 #include "base/metrics/histogram_macros.h"
 #include "base/rand_util.h"
@@ -34,6 +35,19 @@ void RecordP3A(uint64_t answers_count) {
   UMA_HISTOGRAM_EXACT_LINEAR("Brave.P3A.SentAnswersCount", answer, 3);
 }
 
+bool IsP2AMetric(base::StringPiece histogram_name) {
+  return base::StartsWith(histogram_name, "Brave.P2A",
+                          base::CompareCase::SENSITIVE);
+}
+
+void AppendVarint(uint64_t value, std::string* output) {
+  while (value >= 0x80) {
+    output->push_back(static_cast<char>((value & 0x7f) | 0x80));
+    value >>= 7;
+  }
+  output->push_back(static_cast<char>(value));
+}
+
 }  // namespace
 
 BraveP3ALogStore::BraveP3ALogStore(Delegate* delegate,
@@ -74,8 +88,9 @@ void BraveP3ALogStore::RemoveValueIfExists(const std::string& histogram_name) {
   DictionaryPrefUpdate update(local_state_, kPrefName);
   update->RemovePath(histogram_name);
 
-  if (has_staged_log() && staged_entry_key_ == histogram_name) {
-    staged_entry_key_.clear();
+  // Unstage the whole log, it is rebuilt from the remaining values.
+  if (base::Contains(staged_entry_keys_, histogram_name)) {
+    staged_entry_keys_.clear();
     staged_log_.clear();
   }
 }
@@ -106,29 +121,32 @@ void BraveP3ALogStore::ResetUploadStamps() {
   }
 }
 
+void BraveP3ALogStore::set_upload_batch_size(size_t size) {
+  DCHECK_GE(size, 1u);
+  upload_batch_size_ = size;
+}
+
 bool BraveP3ALogStore::has_unsent_logs() const {
   return !unsent_entries_.empty();
 }
 
 bool BraveP3ALogStore::has_staged_log() const {
-  return !staged_entry_key_.empty();
+  return !staged_entry_keys_.empty();
 }
 
 const std::string& BraveP3ALogStore::staged_log() const {
-  DCHECK(!staged_entry_key_.empty());
-  auto iter = log_.find(staged_entry_key_);
-  DCHECK(iter != log_.end());
+  DCHECK(!staged_entry_keys_.empty());
+  DCHECK(log_.find(staged_entry_keys_.front()) != log_.end());
 
   return staged_log_;
 }
 
 std::string BraveP3ALogStore::staged_log_type() const {
-  DCHECK(!staged_entry_key_.empty());
-  auto iter = log_.find(staged_entry_key_);
-  DCHECK(iter != log_.end());
+  DCHECK(!staged_entry_keys_.empty());
+  DCHECK(log_.find(staged_entry_keys_.front()) != log_.end());
 
-  if (base::StartsWith(iter->first, "Brave.P2A",
-                       base::CompareCase::SENSITIVE)) {
+  // All values of a batch share the type of the first one.
+  if (IsP2AMetric(staged_entry_keys_.front())) {
     return "p2a";
   }
   return "p3a";
@@ -152,14 +170,43 @@ absl::optional<uint64_t> BraveP3ALogStore::staged_log_user_id() const {
 void BraveP3ALogStore::StageNextLog() {
   // Stage the next item.
   DCHECK(has_unsent_logs());
-  uint64_t rand_idx = base::RandGenerator(unsent_entries_.size());
-  staged_entry_key_ = *(unsent_entries_.begin() + rand_idx);
-  DCHECK(!log_.find(staged_entry_key_)->second.sent);
+  staged_entry_keys_.clear();
+  staged_log_.clear();
+
+  if (upload_batch_size_ == 1u) {
+    uint64_t rand_idx = base::RandGenerator(unsent_entries_.size());
+    const std::string& key = *(unsent_entries_.begin() + rand_idx);
+    DCHECK(!log_.find(key)->second.sent);
+
+    staged_entry_keys_.push_back(key);
+    staged_log_ = delegate_->Serialize(key, log_[key].value);
 
-  uint64_t staged_entry_value = log_[staged_entry_key_].value;
-  staged_log_ = delegate_->Serialize(staged_entry_key_, staged_entry_value);
+    VLOG(2) << "BraveP3ALogStore::StageNextLog: staged " << key;
+    return;
+  }
+
+  // Shuffle so that neither the batch contents nor the order inside it
+  // depend on the metric names. A batch only holds values of one type, since
+  // P3A and P2A go to different endpoints.
+  std::vector<std::string> candidates(unsent_entries_.begin(),
+                                      unsent_entries_.end());
+  base::RandomShuffle(candidates.begin(), candidates.end());
+  const bool is_p2a = IsP2AMetric(candidates.front());
+  for (const std::string& key : candidates) {
+    if (staged_entry_keys_.size() == upload_batch_size_)
+      break;
+    if (IsP2AMetric(key) != is_p2a)
+      continue;
+    DCHECK(!log_.find(key)->second.sent);
+
+    const std::string value = delegate_->Serialize(key, log_[key].value);
+    AppendVarint(value.size(), &staged_log_);
+    staged_log_.append(value);
+    staged_entry_keys_.push_back(key);
+  }
 
-  VLOG(2) << "BraveP3ALogStore::StageNextLog: staged " << staged_entry_key_;
+  VLOG(2) << "BraveP3ALogStore::StageNextLog: staged "
+          << staged_entry_keys_.size() << " values";
 }
 
 void BraveP3ALogStore::DiscardStagedLog() {
@@ -167,24 +214,26 @@ void BraveP3ALogStore::DiscardStagedLog() {
     return;
   }
 
-  // Mark previous staged log as sent.
-  auto log_iter = log_.find(staged_entry_key_);
-  DCHECK(log_iter != log_.end());
-  log_iter->second.MarkAsSent();
-
-  // Update the persistent value.
   DictionaryPrefUpdate update(local_state_, kPrefName);
-  update->SetPath({log_iter->first, kLogSentKey},
-                  base::Value(log_iter->second.sent));
-  update->SetPath({log_iter->first, kLogTimestampKey},
-                  base::Value(log_iter->second.sent_timestamp.ToDoubleT()));
-
-  // Erase the entry from the unsent queue.
-  auto unsent_entries_iter = unsent_entries_.find(staged_entry_key_);
-  DCHECK(unsent_entries_iter != unsent_entries_.end());
-  unsent_entries_.erase(unsent_entries_iter);
+  for (const std::string& key : staged_entry_keys_) {
+    // Mark previous staged log as sent.
+    auto log_iter = log_.find(key);
+    DCHECK(log_iter != log_.end());
+    log_iter->second.MarkAsSent();
+
+    // Update the persistent value.
+    update->SetPath({log_iter->first, kLogSentKey},
+                    base::Value(log_iter->second.sent));
+    update->SetPath({log_iter->first, kLogTimestampKey},
+                    base::Value(log_iter->second.sent_timestamp.ToDoubleT()));
+
+    // Erase the entry from the unsent queue.
+    auto unsent_entries_iter = unsent_entries_.find(key);
+    DCHECK(unsent_entries_iter != unsent_entries_.end());
+    unsent_entries_.erase(unsent_entries_iter);
+  }
 
-  staged_entry_key_.clear();
+  staged_entry_keys_.clear();
   staged_log_.clear();
 }
 
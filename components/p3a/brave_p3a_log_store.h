@@ -7,6 +7,7 @@
 #define BRAVE_COMPONENTS_P3A_BRAVE_P3A_LOG_STORE_H_
 
 #include <string>
+#include <vector>
 
 #include "base/containers/flat_map.h"
 #include "base/containers/flat_set.h"
@@ -49,6 +50,12 @@ class BraveP3ALogStore : public metrics::LogStore {
   // Marks all saved values as unsent.
   void ResetUploadStamps();
 
+  // Stages up to |size| values of the same type into a single log. Batched
+  // logs hold the serialized values in random order, each prefixed with its
+  // varint-encoded length. With the default size of 1 every value is staged
+  // on its own, as is.
+  void set_upload_batch_size(size_t size);
+
   // metrics::LogStore:
   bool has_unsent_logs() const override;
   bool has_staged_log() const override;
@@ -92,7 +99,9 @@ class BraveP3ALogStore : public metrics::LogStore {
   base::flat_map<std::string, LogEntry> log_;
   base::flat_set<std::string> unsent_entries_;
 
-  std::string staged_entry_key_;
+  size_t upload_batch_size_ = 1u;
+
+  std::vector<std::string> staged_entry_keys_;
   std::string staged_log_;
 
   // Not used for now.
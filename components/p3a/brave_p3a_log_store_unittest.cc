@@ -0,0 +1,135 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/p3a/brave_p3a_log_store.h"
+
+#include <string>
+#include <vector>
+
+#include "base/containers/flat_set.h"
+#include "base/strings/string_number_conversions.h"
+#include "components/prefs/testing_pref_service.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+// npm run test -- brave_unit_tests --filter=BraveP3ALogStoreTest.*
+
+namespace brave {
+
+namespace {
+
+class TestDelegate : public BraveP3ALogStore::Delegate {
+ public:
+  std::string Serialize(base::StringPiece histogram_name,
+                        uint64_t value) override {
+    return std::string(histogram_name) + "=" + base::NumberToString(value);
+  }
+
+  bool IsActualMetric(base::StringPiece histogram_name) const override {
+    return true;
+  }
+};
+
+// Splits a batched log into its length-delimited values.
+base::flat_set<std::string> DecodeBatch(const std::string& log) {
+  base::flat_set<std::string> values;
+  size_t pos = 0;
+  while (pos < log.size()) {
+    uint64_t length = 0;
+    int shift = 0;
+    uint8_t byte;
+    do {
+      byte = static_cast<uint8_t>(log[pos++]);
+      length |= static_cast<uint64_t>(byte & 0x7f) << shift;
+      shift += 7;
+    } while (byte & 0x80);
+    values.insert(log.substr(pos, length));
+    pos += length;
+  }
+  return values;
+}
+
+}  // namespace
+
+class BraveP3ALogStoreTest : public testing::Test {
+ public:
+  BraveP3ALogStoreTest() : log_store_(&delegate_, &local_state_) {
+    BraveP3ALogStore::RegisterPrefs(local_state_.registry());
+  }
+
+ protected:
+  TestingPrefServiceSimple local_state_;
+  TestDelegate delegate_;
+  BraveP3ALogStore log_store_;
+};
+
+TEST_F(BraveP3ALogStoreTest, StagesSingleValues) {
+  log_store_.UpdateValue("Brave.Test.A", 1);
+  log_store_.UpdateValue("Brave.Test.B", 2);
+
+  base::flat_set<std::string> sent;
+  while (log_store_.has_unsent_logs()) {
+    log_store_.StageNextLog();
+    ASSERT_TRUE(log_store_.has_staged_log());
+    EXPECT_EQ(log_store_.staged_log_type(), "p3a");
+    sent.insert(log_store_.staged_log());
+    log_store_.DiscardStagedLog();
+  }
+  EXPECT_EQ(sent,
+            base::flat_set<std::string>({"Brave.Test.A=1", "Brave.Test.B=2"}));
+}
+
+TEST_F(BraveP3ALogStoreTest, StagesBatchesByType) {
+  log_store_.set_upload_batch_size(10);
+  log_store_.UpdateValue("Brave.Test.A", 1);
+  log_store_.UpdateValue("Brave.Test.B", 2);
+  log_store_.UpdateValue("Brave.P2A.Test.C", 3);
+
+  const base::flat_set<std::string> p3a_values = {"Brave.Test.A=1",
+                                                  "Brave.Test.B=2"};
+  const base::flat_set<std::string> p2a_values = {"Brave.P2A.Test.C=3"};
+  size_t uploads = 0;
+  while (log_store_.has_unsent_logs()) {
+    log_store_.StageNextLog();
+    ASSERT_TRUE(log_store_.has_staged_log());
+    EXPECT_EQ(DecodeBatch(log_store_.staged_log()),
+              log_store_.staged_log_type() == "p2a" ? p2a_values
+                                                    : p3a_values);
+    log_store_.DiscardStagedLog();
+    uploads++;
+  }
+  EXPECT_EQ(uploads, 2u);
+}
+
+TEST_F(BraveP3ALogStoreTest, LimitsBatchSize) {
+  log_store_.set_upload_batch_size(2);
+  for (int i = 0; i < 5; i++) {
+    log_store_.UpdateValue("Brave.Test." + base::NumberToString(i), i);
+  }
+
+  std::vector<size_t> batch_sizes;
+  while (log_store_.has_unsent_logs()) {
+    log_store_.StageNextLog();
+    batch_sizes.push_back(DecodeBatch(log_store_.staged_log()).size());
+    log_store_.DiscardStagedLog();
+  }
+  EXPECT_EQ(batch_sizes, std::vector<size_t>({2u, 2u, 1u}));
+}
+
+TEST_F(BraveP3ALogStoreTest, RemovingStagedValueUnstagesBatch) {
+  log_store_.set_upload_batch_size(10);
+  log_store_.UpdateValue("Brave.Test.A", 1);
+  log_store_.UpdateValue("Brave.Test.B", 2);
+
+  log_store_.StageNextLog();
+  ASSERT_TRUE(log_store_.has_staged_log());
+  log_store_.RemoveValueIfExists("Brave.Test.A");
+  EXPECT_FALSE(log_store_.has_staged_log());
+
+  log_store_.StageNextLog();
+  EXPECT_EQ(DecodeBatch(log_store_.staged_log()),
+            base::flat_set<std::string>({"Brave.Test.B=2"}));
+}
+
+}  // namespace brave
@@ -20,6 +20,7 @@
 #include "base/rand_util.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/task/post_task.h"
+#include "base/task/thread_pool.h"
 #include "base/trace_event/trace_event.h"
 #include "brave/components/brave_prochlo/prochlo_message.pb.h"
 #include "brave/components/brave_referrals/common/pref_names.h"
@@ -35,6 +36,7 @@
 #include "components/prefs/pref_registry_simple.h"
 #include "components/prefs/pref_service.h"
 #include "content/public/browser/browser_task_traits.h"
+#include "content/public/browser/browser_thread.h"
 #include "services/network/public/cpp/shared_url_loader_factory.h"
 #include "third_party/metrics_proto/reporting_info.pb.h"
 
@@ -55,6 +57,9 @@ constexpr char kP2AServerUrl[] = "https://p2a.brave.com/";
 
 constexpr uint64_t kDefaultUploadIntervalSeconds = 60;  // 1 minute.
 
+// Histogram changes recorded within this delay are processed together.
+constexpr base::TimeDelta kHistogramFlushDelay = base::Seconds(1);
+
 // TODO(iefremov): Provide moar histograms!
 // Whitelist for histograms that we collect. Will be replaced with something
 // updating on the fly.
@@ -176,6 +181,26 @@ bool IsSuspendedMetric(base::StringPiece metric_name,
   return value_or_bucket == kSuspendedMetricBucket;
 }
 
+// Returns the index of the bucket holding |sample|. |samples| can hold several
+// samples when changes were coalesced, but only the latest one is reported.
+bool GetBucketIndexForSample(const base::HistogramSamples& samples,
+                             base::HistogramBase::Sample sample,
+                             size_t* bucket) {
+  std::unique_ptr<base::SampleCountIterator> it = samples.Iterator();
+  // Falls back to the first non-empty bucket.
+  if (!it->GetBucketIndex(bucket))
+    return false;
+  for (; !it->Done(); it->Next()) {
+    base::HistogramBase::Sample min;
+    int64_t max;
+    base::HistogramBase::Count count;
+    it->Get(&min, &max, &count);
+    if (min <= sample && sample < max)
+      return it->GetBucketIndex(bucket);
+  }
+  return true;
+}
+
 base::TimeDelta GetRandomizedUploadInterval(
     base::TimeDelta average_upload_interval) {
   const auto delta = base::Seconds(
@@ -208,7 +233,10 @@ BraveP3AService::BraveP3AService(PrefService* local_state,
                                  std::string week_of_install)
     : local_state_(std::move(local_state)),
       channel_(std::move(channel)),
-      week_of_install_(week_of_install) {}
+      week_of_install_(week_of_install),
+      histogram_task_runner_(base::ThreadPool::CreateSequencedTaskRunner(
+          {base::TaskPriority::BEST_EFFORT,
+           base::TaskShutdownBehavior::CONTINUE_ON_SHUTDOWN})) {}
 
 BraveP3AService::~BraveP3AService() = default;
 
@@ -247,12 +275,14 @@ void BraveP3AService::Init(
           << ", average_upload_interval_ = " << average_upload_interval_
           << ", randomize_upload_interval_ = " << randomize_upload_interval_
           << ", upload_server_url_ = " << upload_server_url_.spec()
-          << ", rotation_interval_ = " << rotation_interval_;
+          << ", rotation_interval_ = " << rotation_interval_
+          << ", upload_batch_size_ = " << upload_batch_size_;
 
   InitMessageMeta();
 
   // Init log store.
   log_store_.reset(new BraveP3ALogStore(this, local_state_));
+  log_store_->set_upload_batch_size(upload_batch_size_);
   log_store_->LoadPersistedUnsentLogs();
   // Store values that were recorded between calling constructor and |Init()|.
   for (const auto& entry : histogram_values_) {
@@ -279,6 +309,7 @@ void BraveP3AService::Init(
   uploader_.reset(new BraveP3AUploader(
       url_loader_factory, upload_server_url_, GURL(kP2AServerUrl),
       base::BindRepeating(&BraveP3AService::OnLogUploadComplete, this)));
+  uploader_->set_batch_uploads(upload_batch_size_ > 1u);
 
   upload_scheduler_.reset(new BraveP3AScheduler(
       base::BindRepeating(&BraveP3AService::StartScheduledUpload, this),
@@ -342,6 +373,15 @@ void BraveP3AService::MaybeOverrideSettingsFromCommandLine() {
     }
   }
 
+  if (cmdline->HasSwitch(switches::kP3AUploadBatchSize)) {
+    std::string size_str =
+        cmdline->GetSwitchValueASCII(switches::kP3AUploadBatchSize);
+    size_t size;
+    if (base::StringToSizeT(size_str, &size) && size > 0) {
+      upload_batch_size_ = size;
+    }
+  }
+
   if (cmdline->HasSwitch(switches::kP3AUploadServerUrl)) {
     GURL url =
         GURL(cmdline->GetSwitchValueASCII(switches::kP3AUploadServerUrl));
@@ -413,53 +453,125 @@ void BraveP3AService::StartScheduledUpload() {
 void BraveP3AService::OnHistogramChanged(const char* histogram_name,
                                          uint64_t name_hash,
                                          base::HistogramBase::Sample sample) {
-  std::unique_ptr<base::HistogramSamples> samples =
-      base::StatisticsRecorder::FindHistogram(histogram_name)->SnapshotDelta();
-
-  // Stop now if there's nothing to do.
-  if (samples->Iterator()->Done())
+  // Only the latest value of a histogram is reported, so changes are
+  // coalesced until the next flush.
+  base::AutoLock lock(pending_histogram_changes_lock_);
+  pending_histogram_changes_[histogram_name] = sample;
+  if (histogram_flush_scheduled_)
     return;
+  histogram_flush_scheduled_ = true;
+  histogram_task_runner_->PostDelayedTask(
+      FROM_HERE, base::BindOnce(&BraveP3AService::FlushHistogramChanges, this),
+      kHistogramFlushDelay);
+}
+
+void BraveP3AService::FlushPendingHistogramChanges() {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  // The deferred flush may still be scheduled, but it will find nothing left.
+  // Changes it has already taken are applied first.
+  TakeHistogramChanges();
+  ApplyTakenHistogramChanges();
+}
 
-  // Shortcut for the special values, see |kSuspendedMetricValue|
-  // description for details.
-  if (IsSuspendedMetric(histogram_name, sample)) {
-    base::PostTask(FROM_HERE, {content::BrowserThread::UI},
-                   base::BindOnce(&BraveP3AService::OnHistogramChangedOnUI,
-                                  this,
-                                  histogram_name,
-                                  kSuspendedMetricValue,
-                                  kSuspendedMetricBucket));
+void BraveP3AService::SetHistogramsChangedCallbackForTesting(
+    HistogramsChangedCallback callback) {
+  histograms_changed_callback_for_testing_ = std::move(callback);
+}
+
+void BraveP3AService::FlushHistogramChanges() {
+  DCHECK(histogram_task_runner_->RunsTasksInCurrentSequence());
+  if (!TakeHistogramChanges())
     return;
+  base::PostTask(
+      FROM_HERE, {content::BrowserThread::UI},
+      base::BindOnce(&BraveP3AService::ApplyTakenHistogramChanges, this));
+}
+
+bool BraveP3AService::TakeHistogramChanges() {
+  base::AutoLock taken_lock(taken_histogram_changes_lock_);
+
+  base::flat_map<const char*, base::HistogramBase::Sample> pending_changes;
+  {
+    base::AutoLock lock(pending_histogram_changes_lock_);
+    pending_changes.swap(pending_histogram_changes_);
+    histogram_flush_scheduled_ = false;
   }
 
-  // Note that we store only buckets, not actual values.
-  size_t bucket = 0u;
-  const bool ok = samples->Iterator()->GetBucketIndex(&bucket);
-  if (!ok) {
-    LOG(ERROR) << "Only linear histograms are supported at the moment!";
-    NOTREACHED();
-    return;
+  std::vector<HistogramChange> changes;
+  for (const auto& pending_change : pending_changes) {
+    const char* histogram_name = pending_change.first;
+    const base::HistogramBase::Sample sample = pending_change.second;
+    std::unique_ptr<base::HistogramSamples> samples =
+        base::StatisticsRecorder::FindHistogram(histogram_name)
+            ->SnapshotDelta();
+
+    // Skip if there's nothing to do.
+    if (samples->Iterator()->Done())
+      continue;
+
+    // Shortcut for the special values, see |kSuspendedMetricValue|
+    // description for details.
+    if (IsSuspendedMetric(histogram_name, sample)) {
+      changes.push_back(
+          {histogram_name, kSuspendedMetricValue, kSuspendedMetricBucket});
+      continue;
+    }
+
+    // Note that we store only buckets, not actual values.
+    size_t bucket = 0u;
+    const bool ok = GetBucketIndexForSample(*samples, sample, &bucket);
+    if (!ok) {
+      LOG(ERROR) << "Only linear histograms are supported at the moment!";
+      NOTREACHED();
+      continue;
+    }
+
+    // Special handling of P2A histograms.
+    if (base::StartsWith(histogram_name, "Brave.P2A.",
+                         base::CompareCase::SENSITIVE)) {
+      // We need the bucket count to make proper perturbation.
+      // All P2A metrics should be implemented as linear histograms.
+      base::SampleVector* vector =
+          static_cast<base::SampleVector*>(samples.get());
+      DCHECK(vector);
+      const size_t bucket_count = vector->bucket_ranges()->bucket_count() - 1;
+      VLOG(2) << "P2A metric " << histogram_name << " has bucket count "
+              << bucket_count;
+
+      // Perturb the bucket.
+      bucket = DirectEncodingProtocol::Perturb(bucket_count, bucket);
+    }
+
+    changes.push_back({histogram_name, sample, bucket});
   }
 
-  // Special handling of P2A histograms.
-  if (base::StartsWith(histogram_name, "Brave.P2A.",
-                       base::CompareCase::SENSITIVE)) {
-    // We need the bucket count to make proper perturbation.
-    // All P2A metrics should be implemented as linear histograms.
-    base::SampleVector* vector =
-        static_cast<base::SampleVector*>(samples.get());
-    DCHECK(vector);
-    const size_t bucket_count = vector->bucket_ranges()->bucket_count() - 1;
-    VLOG(2) << "P2A metric " << histogram_name << " has bucket count "
-            << bucket_count;
-
-    // Perturb the bucket.
-    bucket = DirectEncodingProtocol::Perturb(bucket_count, bucket);
+  if (changes.empty())
+    return false;
+  taken_histogram_changes_.push_back(std::move(changes));
+  return true;
+}
+
+void BraveP3AService::ApplyTakenHistogramChanges() {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  std::vector<std::vector<HistogramChange>> taken_changes;
+  {
+    base::AutoLock taken_lock(taken_histogram_changes_lock_);
+    taken_changes.swap(taken_histogram_changes_);
+  }
+
+  for (auto& changes : taken_changes)
+    OnHistogramsChangedOnUI(std::move(changes));
+}
+
+void BraveP3AService::OnHistogramsChangedOnUI(
+    std::vector<HistogramChange> changes) {
+  for (const HistogramChange& change : changes) {
+    OnHistogramChangedOnUI(change.histogram_name, change.sample,
+                           change.bucket);
   }
 
-  base::PostTask(FROM_HERE, {content::BrowserThread::UI},
-                 base::BindOnce(&BraveP3AService::OnHistogramChangedOnUI, this,
-                                histogram_name, sample, bucket));
+  if (histograms_changed_callback_for_testing_)
+    histograms_changed_callback_for_testing_.Run(changes);
 }
 
 void BraveP3AService::OnHistogramChangedOnUI(const char* histogram_name,
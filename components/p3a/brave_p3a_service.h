@@ -10,10 +10,14 @@
 #include <string>
 #include <vector>
 
+#include "base/callback.h"
 #include "base/containers/flat_map.h"
 #include "base/memory/ref_counted.h"
 #include "base/metrics/histogram_base.h"
 #include "base/metrics/statistics_recorder.h"
+#include "base/synchronization/lock.h"
+#include "base/task/sequenced_task_runner.h"
+#include "base/thread_annotations.h"
 #include "base/timer/wall_clock_timer.h"
 #include "brave/components/p3a/brave_p3a_log_store.h"
 #include "brave/components/p3a/p3a_message.h"
@@ -58,6 +62,24 @@ class BraveP3AService : public base::RefCountedThreadSafe<BraveP3AService>,
   // May be accessed from multiple threads, so this is thread-safe.
   bool IsActualMetric(base::StringPiece histogram_name) const override;
 
+  // Processes histogram changes still waiting for the deferred flush right
+  // away, so that samples recorded just before shutdown are not lost. Must be
+  // called on UI thread.
+  void FlushPendingHistogramChanges();
+
+  struct HistogramChange {
+    const char* histogram_name;
+    base::HistogramBase::Sample sample;
+    size_t bucket;
+  };
+
+  using HistogramsChangedCallback =
+      base::RepeatingCallback<void(const std::vector<HistogramChange>&)>;
+
+  // Invoked on UI thread with every batch of processed histogram changes.
+  void SetHistogramsChangedCallbackForTesting(
+      HistogramsChangedCallback callback);
+
  private:
   friend class base::RefCountedThreadSafe<BraveP3AService>;
   ~BraveP3AService() override;
@@ -72,11 +94,26 @@ class BraveP3AService : public base::RefCountedThreadSafe<BraveP3AService>,
   void StartScheduledUpload();
 
   // Invoked by callbacks registered by our service. Since these callbacks
-  // can fire on any thread, this method reposts everything to UI thread.
+  // can fire on any thread, this method only marks the histogram as changed
+  // and schedules a deferred |FlushHistogramChanges()|.
   void OnHistogramChanged(const char* histogram_name,
                           uint64_t name_hash,
                           base::HistogramBase::Sample sample);
 
+  // Snapshots all changed histograms on |histogram_task_runner_| and reposts
+  // the resulting buckets to UI thread in a single task.
+  void FlushHistogramChanges();
+
+  // Takes the pending histogram changes and queues the bucket to report for
+  // each of them. Returns false if there was nothing to report. Can be called
+  // on any thread, but never snapshots histograms concurrently.
+  bool TakeHistogramChanges();
+
+  // Applies all queued histogram changes in the order they were taken.
+  void ApplyTakenHistogramChanges();
+
+  void OnHistogramsChangedOnUI(std::vector<HistogramChange> changes);
+
   void OnHistogramChangedOnUI(const char* histogram_name,
                               base::HistogramBase::Sample sample,
                               size_t bucket);
@@ -104,6 +141,8 @@ class BraveP3AService : public base::RefCountedThreadSafe<BraveP3AService>,
   // Interval between rotations, only used for testing from the command line.
   base::TimeDelta rotation_interval_;
   GURL upload_server_url_;
+  // Number of values sent in a single upload.
+  size_t upload_batch_size_ = 1u;
 
   MessageMetainfo message_meta_;
 
@@ -112,6 +151,25 @@ class BraveP3AService : public base::RefCountedThreadSafe<BraveP3AService>,
   std::unique_ptr<BraveP3AUploader> uploader_;
   std::unique_ptr<BraveP3AScheduler> upload_scheduler_;
 
+  // Snapshots and buckets histogram changes off UI thread.
+  scoped_refptr<base::SequencedTaskRunner> histogram_task_runner_;
+
+  // Latest sample of every histogram changed since the last flush. Keyed by
+  // the histogram name pointer, which stays valid as long as the histogram.
+  base::Lock pending_histogram_changes_lock_;
+  base::flat_map<const char*, base::HistogramBase::Sample>
+      pending_histogram_changes_ GUARDED_BY(pending_histogram_changes_lock_);
+  bool histogram_flush_scheduled_
+      GUARDED_BY(pending_histogram_changes_lock_) = false;
+
+  // Held while histograms are snapshotted, so that the deferred flush and the
+  // shutdown flush take changes one after the other.
+  base::Lock taken_histogram_changes_lock_;
+  std::vector<std::vector<HistogramChange>> taken_histogram_changes_
+      GUARDED_BY(taken_histogram_changes_lock_);
+
+  HistogramsChangedCallback histograms_changed_callback_for_testing_;
+
   // Used to store histogram values that are produced between constructing
   // the service and its initialization.
   base::flat_map<base::StringPiece, size_t> histogram_values_;
@@ -0,0 +1,176 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/p3a/brave_p3a_service.h"
+
+#include <climits>
+#include <memory>
+#include <vector>
+
+#include "base/bind.h"
+#include "base/metrics/histogram_functions.h"
+#include "base/metrics/statistics_recorder.h"
+#include "components/prefs/testing_pref_service.h"
+#include "content/public/test/browser_task_environment.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+// npm run test -- brave_unit_tests --filter=BraveP3AServiceTest.*
+
+namespace brave {
+
+namespace {
+
+// Matches |kHistogramFlushDelay| in brave_p3a_service.cc.
+constexpr base::TimeDelta kFlushDelay = base::Seconds(1);
+
+constexpr char kP3AHistogramName[] = "Brave.Core.TabCount";
+constexpr int kP3AHistogramExclusiveMax = 5;
+
+constexpr char kP2AHistogramName[] = "Brave.P2A.TotalAdOpportunities";
+constexpr int kP2AHistogramExclusiveMax = 9;
+
+}  // namespace
+
+class BraveP3AServiceTest : public testing::Test {
+ public:
+  BraveP3AServiceTest()
+      : task_environment_(base::test::TaskEnvironment::TimeSource::MOCK_TIME),
+        statistics_recorder_(
+            base::StatisticsRecorder::CreateTemporaryForTesting()) {
+    BraveP3AService::RegisterPrefs(local_state_.registry(),
+                                   /*first_run=*/false);
+  }
+
+  void SetUp() override {
+    service_ = base::MakeRefCounted<BraveP3AService>(&local_state_, "release",
+                                                     "2021-01-04");
+    service_->InitCallbacks();
+    service_->SetHistogramsChangedCallbackForTesting(base::BindRepeating(
+        &BraveP3AServiceTest::OnHistogramsChanged, base::Unretained(this)));
+  }
+
+  void TearDown() override {
+    // Run any scheduled flush while the temporary recorder is still alive.
+    task_environment_.FastForwardBy(kFlushDelay);
+    service_ = nullptr;
+  }
+
+ protected:
+  void OnHistogramsChanged(
+      const std::vector<BraveP3AService::HistogramChange>& changes) {
+    flushed_changes_.push_back(changes);
+  }
+
+  content::BrowserTaskEnvironment task_environment_;
+  std::unique_ptr<base::StatisticsRecorder> statistics_recorder_;
+  TestingPrefServiceSimple local_state_;
+  scoped_refptr<BraveP3AService> service_;
+  std::vector<std::vector<BraveP3AService::HistogramChange>> flushed_changes_;
+};
+
+TEST_F(BraveP3AServiceTest, CoalesceChangesWithinFlushDelay) {
+  // Arrange
+  base::UmaHistogramExactLinear(kP3AHistogramName, 1,
+                                kP3AHistogramExclusiveMax);
+  base::UmaHistogramExactLinear(kP3AHistogramName, 2,
+                                kP3AHistogramExclusiveMax);
+
+  // Act
+  task_environment_.FastForwardBy(kFlushDelay / 2);
+  base::UmaHistogramExactLinear(kP3AHistogramName, 3,
+                                kP3AHistogramExclusiveMax);
+  task_environment_.FastForwardBy(kFlushDelay);
+
+  // Assert
+  ASSERT_EQ(1UL, flushed_changes_.size());
+  ASSERT_EQ(1UL, flushed_changes_[0].size());
+  EXPECT_STREQ(kP3AHistogramName, flushed_changes_[0][0].histogram_name);
+  EXPECT_EQ(3, flushed_changes_[0][0].sample);
+  EXPECT_EQ(3UL, flushed_changes_[0][0].bucket);
+}
+
+TEST_F(BraveP3AServiceTest, ReportBucketOfLatestSample) {
+  // Arrange
+  base::UmaHistogramExactLinear(kP3AHistogramName, 3,
+                                kP3AHistogramExclusiveMax);
+  base::UmaHistogramExactLinear(kP3AHistogramName, 1,
+                                kP3AHistogramExclusiveMax);
+  base::UmaHistogramExactLinear(kP3AHistogramName, 2,
+                                kP3AHistogramExclusiveMax);
+
+  // Act
+  task_environment_.FastForwardBy(kFlushDelay);
+
+  // Assert
+  ASSERT_EQ(1UL, flushed_changes_.size());
+  ASSERT_EQ(1UL, flushed_changes_[0].size());
+  EXPECT_EQ(2, flushed_changes_[0][0].sample);
+  EXPECT_EQ(2UL, flushed_changes_[0][0].bucket);
+}
+
+TEST_F(BraveP3AServiceTest, ReportSuspendedMetric) {
+  // Arrange
+  base::UmaHistogramExactLinear(kP2AHistogramName, 1,
+                                kP2AHistogramExclusiveMax);
+  base::UmaHistogramExactLinear(kP2AHistogramName, INT_MAX,
+                                kP2AHistogramExclusiveMax);
+
+  // Act
+  task_environment_.FastForwardBy(kFlushDelay);
+
+  // Assert
+  ASSERT_EQ(1UL, flushed_changes_.size());
+  ASSERT_EQ(1UL, flushed_changes_[0].size());
+  EXPECT_EQ(INT_MAX - 1, flushed_changes_[0][0].sample);
+  EXPECT_EQ(static_cast<size_t>(INT_MAX - 1), flushed_changes_[0][0].bucket);
+}
+
+TEST_F(BraveP3AServiceTest, PerturbP2ABucket) {
+  // Arrange
+  constexpr int kSample = 2;
+  constexpr size_t kTrials = 100;
+
+  // Act
+  for (size_t i = 0; i < kTrials; i++) {
+    base::UmaHistogramExactLinear(kP2AHistogramName, kSample,
+                                  kP2AHistogramExclusiveMax);
+    task_environment_.FastForwardBy(kFlushDelay);
+  }
+
+  // Assert
+  ASSERT_EQ(kTrials, flushed_changes_.size());
+  size_t perturbed_count = 0;
+  for (const auto& changes : flushed_changes_) {
+    ASSERT_EQ(1UL, changes.size());
+    EXPECT_EQ(kSample, changes[0].sample);
+    EXPECT_LT(changes[0].bucket,
+              static_cast<size_t>(kP2AHistogramExclusiveMax));
+    if (changes[0].bucket != static_cast<size_t>(kSample))
+      perturbed_count++;
+  }
+  // The true bucket is reported with a probability of about one half, so all
+  // of the trials reporting it is practically impossible.
+  EXPECT_GT(perturbed_count, 0UL);
+}
+
+TEST_F(BraveP3AServiceTest, FlushPendingHistogramChanges) {
+  // Arrange
+  base::UmaHistogramExactLinear(kP3AHistogramName, 1,
+                                kP3AHistogramExclusiveMax);
+  task_environment_.RunUntilIdle();
+
+  // Act
+  service_->FlushPendingHistogramChanges();
+
+  // Assert
+  ASSERT_EQ(1UL, flushed_changes_.size());
+  ASSERT_EQ(1UL, flushed_changes_[0].size());
+  EXPECT_EQ(1UL, flushed_changes_[0][0].bucket);
+
+  task_environment_.FastForwardBy(kFlushDelay);
+  EXPECT_EQ(1UL, flushed_changes_.size());
+}
+
+}  // namespace brave
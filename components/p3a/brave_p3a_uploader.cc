@@ -93,6 +93,9 @@ void BraveP3AUploader::UploadLog(const std::string& compressed_log_data,
   } else {
     NOTREACHED();
   }
+  if (batch_uploads_) {
+    resource_request->headers.SetHeader("X-Brave-P3A-Batch", "?1");
+  }
 
   resource_request->credentials_mode = network::mojom::CredentialsMode::kOmit;
   resource_request->method = "POST";
@@ -32,6 +32,9 @@ class BraveP3AUploader {
 
   ~BraveP3AUploader();
 
+  // Marks uploads as batches of length-delimited values for the server.
+  void set_batch_uploads(bool batch_uploads) { batch_uploads_ = batch_uploads; }
+
   // From metrics::MetricsLogUploader
   void UploadLog(const std::string& compressed_log_data,
                  const std::string& upload_type);
@@ -43,6 +46,7 @@ class BraveP3AUploader {
   const GURL p3a_endpoint_;
   const GURL p2a_endpoint_;
   const UploadCallback on_upload_complete_;
+  bool batch_uploads_ = false;
   std::unique_ptr<network::SimpleURLLoader> url_loader_;
   DISALLOW_COPY_AND_ASSIGN(BraveP3AUploader);
 };
@@ -87,36 +87,6 @@ void BatAdsClientMojoBridge::CloseNotification(
   bat_ads_client_->CloseNotification(uuid);
 }
 
-void BatAdsClientMojoBridge::RecordAdEvent(const std::string& ad_type,
-                                           const std::string& confirmation_type,
-                                           const double timestamp) const {
-  if (!connected()) {
-    return;
-  }
-
-  bat_ads_client_->RecordAdEvent(ad_type, confirmation_type, timestamp);
-}
-
-std::vector<double> BatAdsClientMojoBridge::GetAdEvents(
-    const std::string& ad_type,
-    const std::string& confirmation_type) const {
-  if (!connected()) {
-    return {};
-  }
-
-  std::vector<double> ad_events;
-  bat_ads_client_->GetAdEvents(ad_type, confirmation_type, &ad_events);
-  return ad_events;
-}
-
-void BatAdsClientMojoBridge::ResetAdEvents() const {
-  if (!connected()) {
-    return;
-  }
-
-  bat_ads_client_->ResetAdEvents();
-}
-
 void OnUrlRequest(const ads::UrlRequestCallback& callback,
                   const ads::mojom::UrlResponsePtr url_response_ptr) {
   ads::mojom::UrlResponse url_response;
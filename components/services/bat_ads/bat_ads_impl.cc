@@ -74,6 +74,17 @@ void BatAdsImpl::OnHtmlLoaded(const int32_t tab_id,
   ads_->OnHtmlLoaded(tab_id, redirect_chain, html);
 }
 
+void BatAdsImpl::ShouldCaptureHtmlForConversion(
+    const std::vector<std::string>& redirect_chain,
+    ShouldCaptureHtmlForConversionCallback callback) {
+  auto* holder = new CallbackHolder<ShouldCaptureHtmlForConversionCallback>(
+      AsWeakPtr(), std::move(callback));
+
+  ads_->ShouldCaptureHtmlForConversion(
+      redirect_chain,
+      std::bind(BatAdsImpl::OnShouldCaptureHtmlForConversion, holder, _1));
+}
+
 void BatAdsImpl::OnTextLoaded(const int32_t tab_id,
                               const std::vector<std::string>& redirect_chain,
                               const std::string& text) {
@@ -294,6 +305,16 @@ void BatAdsImpl::OnShutdown(CallbackHolder<ShutdownCallback>* holder,
   delete holder;
 }
 
+void BatAdsImpl::OnShouldCaptureHtmlForConversion(
+    CallbackHolder<ShouldCaptureHtmlForConversionCallback>* holder,
+    const bool should_capture) {
+  if (holder->is_valid()) {
+    std::move(holder->get()).Run(should_capture);
+  }
+
+  delete holder;
+}
+
 void BatAdsImpl::OnGetInlineContentAd(
     CallbackHolder<GetInlineContentAdCallback>* holder,
     const bool success,
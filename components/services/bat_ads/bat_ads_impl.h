@@ -53,6 +53,10 @@ class BatAdsImpl :
                     const std::vector<std::string>& redirect_chain,
                     const std::string& html) override;
 
+  void ShouldCaptureHtmlForConversion(
+      const std::vector<std::string>& redirect_chain,
+      ShouldCaptureHtmlForConversionCallback callback) override;
+
   void OnTextLoaded(const int32_t tab_id,
                     const std::vector<std::string>& redirect_chain,
                     const std::string& text) override;
@@ -170,6 +174,10 @@ class BatAdsImpl :
     static void OnShutdown(CallbackHolder<ShutdownCallback>* holder,
                            const bool success);
 
+    static void OnShouldCaptureHtmlForConversion(
+        CallbackHolder<ShouldCaptureHtmlForConversionCallback>* holder,
+        const bool should_capture);
+
     static void OnGetInlineContentAd(
         CallbackHolder<GetInlineContentAdCallback>* holder,
         const bool success,
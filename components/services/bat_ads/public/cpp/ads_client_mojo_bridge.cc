@@ -88,20 +88,6 @@ void AdsClientMojoBridge::ShouldShowNotifications(
   std::move(callback).Run(ads_client_->ShouldShowNotifications());
 }
 
-bool AdsClientMojoBridge::GetAdEvents(const std::string& ad_type,
-                                      const std::string& confirmation_type,
-                                      std::vector<double>* out_ad_events) {
-  DCHECK(out_ad_events);
-  *out_ad_events = ads_client_->GetAdEvents(ad_type, confirmation_type);
-  return true;
-}
-
-void AdsClientMojoBridge::GetAdEvents(const std::string& ad_type,
-                                      const std::string& confirmation_type,
-                                      GetAdEventsCallback callback) {
-  std::move(callback).Run(ads_client_->GetAdEvents(ad_type, confirmation_type));
-}
-
 bool AdsClientMojoBridge::LoadResourceForId(
     const std::string& id,
     std::string* out_value) {
@@ -280,16 +266,6 @@ void AdsClientMojoBridge::CloseNotification(
   ads_client_->CloseNotification(uuid);
 }
 
-void AdsClientMojoBridge::RecordAdEvent(const std::string& ad_type,
-                                        const std::string& confirmation_type,
-                                        const double timestamp) {
-  ads_client_->RecordAdEvent(ad_type, confirmation_type, timestamp);
-}
-
-void AdsClientMojoBridge::ResetAdEvents() {
-  ads_client_->ResetAdEvents();
-}
-
 // static
 void AdsClientMojoBridge::OnRunDBTransaction(
     CallbackHolder<RunDBTransactionCallback>* holder,
@@ -44,12 +44,6 @@ class AdsClientMojoBridge
   bool ShouldShowNotifications(bool* out_should_show) override;
   void ShouldShowNotifications(
       ShouldShowNotificationsCallback callback) override;
-  bool GetAdEvents(const std::string& ad_type,
-                   const std::string& confirmation_type,
-                   std::vector<double>* out_ad_events) override;
-  void GetAdEvents(const std::string& ad_type,
-                   const std::string& confirmation_type,
-                   GetAdEventsCallback callback) override;
 
   bool LoadResourceForId(
       const std::string& id,
@@ -93,11 +87,6 @@ class AdsClientMojoBridge
   void CloseNotification(
       const std::string& uuid) override;
 
-  void RecordAdEvent(const std::string& ad_type,
-                     const std::string& confirmation_type,
-                     const double timestamp) override;
-  void ResetAdEvents() override;
-
   void RunDBTransaction(ads::mojom::DBTransactionPtr transaction,
                         RunDBTransactionCallback callback) override;
   void OnAdRewardsChanged() override;
@@ -28,13 +28,6 @@ class AdsClientIOS : public ads::AdsClient {
   void ShowNotification(const ads::AdNotificationInfo& info) override;
   bool ShouldShowNotifications() override;
   void CloseNotification(const std::string& uuid) override;
-  void RecordAdEvent(const std::string& ad_type,
-                     const std::string& confirmation_type,
-                     const double timestamp) const override;
-  std::vector<double> GetAdEvents(
-      const std::string& ad_type,
-      const std::string& confirmation_type) const override;
-  void ResetAdEvents() const override;
   void UrlRequest(ads::mojom::UrlRequestPtr url_request,
                   ads::UrlRequestCallback callback) override;
   void Save(const std::string& name,
@@ -45,24 +45,6 @@ void AdsClientIOS::CloseNotification(const std::string& uuid) {
   [bridge_ closeNotification:uuid];
 }
 
-void AdsClientIOS::RecordAdEvent(const std::string& ad_type,
-                                 const std::string& confirmation_type,
-                                 const double timestamp) const {
-  [bridge_ recordAdEvent:ad_type
-        confirmationType:confirmation_type
-               timestamp:timestamp];
-}
-
-std::vector<double> AdsClientIOS::GetAdEvents(
-    const std::string& ad_type,
-    const std::string& confirmation_type) const {
-  return [bridge_ getAdEvents:ad_type confirmationType:confirmation_type];
-}
-
-void AdsClientIOS::ResetAdEvents() const {
-  [bridge_ resetAdEvents];
-}
-
 void AdsClientIOS::UrlRequest(ads::mojom::UrlRequestPtr url_request,
                               ads::UrlRequestCallback callback) {
   [bridge_ UrlRequest:std::move(url_request) callback:callback];
@@ -19,7 +19,6 @@
 #include "base/task/thread_pool.h"
 #include "bat/ads/ad_content_action_types.h"
 #include "bat/ads/ad_content_info.h"
-#include "bat/ads/ad_event_history.h"
 #include "bat/ads/ad_history_info.h"
 #include "bat/ads/ad_notification_info.h"
 #include "bat/ads/ads.h"
@@ -110,7 +109,6 @@ ads::mojom::DBCommandResponsePtr RunDBTransactionOnTaskRunner(
   AdsClientIOS* adsClient;
   ads::Ads* ads;
   ads::Database* adsDatabase;
-  ads::AdEventHistory* adEventHistory;
   scoped_refptr<base::SequencedTaskRunner> databaseQueue;
 
   nw_path_monitor_t networkMonitor;
@@ -135,7 +133,6 @@ ads::mojom::DBCommandResponsePtr RunDBTransactionOnTaskRunner(
     self.storagePath = path;
     self.commonOps = [[BraveCommonOperations alloc] initWithStoragePath:path];
     adsDatabase = nullptr;
-    adEventHistory = nullptr;
 
     self.prefsWriteThread =
         dispatch_queue_create("com.rewards.ads.prefs", DISPATCH_QUEUE_SERIAL);
@@ -194,7 +191,6 @@ ads::mojom::DBCommandResponsePtr RunDBTransactionOnTaskRunner(
     delete adsClient;
     ads = nil;
     adsClient = nil;
-    adEventHistory = nil;
   }
 }
 
@@ -263,8 +259,6 @@ BATClassAdsBridge(BOOL, isDebug, setDebug, g_is_debug)
   const auto dbPath = base::SysNSStringToUTF8([self adsDatabasePath]);
   adsDatabase = new ads::Database(base::FilePath(dbPath));
 
-  adEventHistory = new ads::AdEventHistory();
-
   adsClient = new AdsClientIOS(self);
   ads = ads::Ads::CreateInstance(adsClient);
   ads->Initialize(^(const bool success) {
@@ -310,13 +304,9 @@ BATClassAdsBridge(BOOL, isDebug, setDebug, g_is_debug)
         if (self->adsDatabase != nil) {
           delete self->adsDatabase;
         }
-        if (self->adEventHistory != nil) {
-          delete self->adEventHistory;
-        }
         self->ads = nil;
         self->adsClient = nil;
         self->adsDatabase = nil;
-        self->adEventHistory = nil;
         if (completion) {
           completion();
         }
@@ -1247,33 +1237,6 @@ BATClassAdsBridge(BOOL, isDebug, setDebug, g_is_debug)
   [self.notificationsHandler clearNotificationWithIdentifier:bridgedId];
 }
 
-- (void)recordAdEvent:(const std::string&)ad_type
-     confirmationType:(const std::string&)confirmation_type
-            timestamp:(const double)timestamp {
-  if (!adEventHistory) {
-    return;
-  }
-
-  adEventHistory->Record(ad_type, confirmation_type, timestamp);
-}
-
-- (std::vector<double>)getAdEvents:(const std::string&)ad_type
-                  confirmationType:(const std::string&)confirmation_type {
-  if (!adEventHistory) {
-    return {};
-  }
-
-  return adEventHistory->Get(ad_type, confirmation_type);
-}
-
-- (void)resetAdEvents {
-  if (!adEventHistory) {
-    return;
-  }
-
-  return adEventHistory->Reset();
-}
-
 - (bool)shouldAllowAdsSubdivisionTargeting {
   return self.shouldAllowSubdivisionTargeting;
 }
@@ -0,0 +1,154 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2021 The Brave Authors. All rights reserved.
+# This Source Code Form is subject to the terms of the Mozilla Public
+# License, v. 2.0. If a copy of the MPL was not distributed with this file,
+# You can obtain one at https://mozilla.org/MPL/2.0/.
+
+"""
+Converts a JSON text classification pipeline for bat-native-ads into the
+compact binary pipeline format parsed by |ParsePipelineBinary| in
+vendor/bat-native-ads/src/bat/ads/internal/ml/pipeline/pipeline_util.cc.
+
+The binary format is little-endian and laid out as follows, where strings are
+a uint32 byte length followed by UTF-8 bytes:
+
+    magic                   "BAML"
+    format version          uint32
+    pipeline version        int32
+    timestamp               string
+    locale                  string
+    transformation count    uint32
+    transformations         uint8 type, followed for HASHED_NGRAMS by int32
+                            bucket count, uint32 ngram range count and int32
+                            ngram range
+    segment count           uint32
+    segments                string, in ascending byte order
+    bucket count            uint32
+    dimension counts        int32 per segment
+    padding                 zeroes up to an 8 byte boundary
+    biases                  float64 per segment
+    weights                 float64, bucket-major, i.e. the weight for a bucket
+                            and segment is at bucket * segment count + segment
+
+Usage:
+    ads_pipeline_to_binary.py --input pipeline.json --output pipeline.bin
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+MAGIC = b'BAML'
+FORMAT_VERSION = 1
+
+# Must match |TransformationType| in
+# vendor/bat-native-ads/src/bat/ads/internal/ml/transformation/transformation_types.h
+TRANSFORMATION_TYPES = {
+    'TO_LOWER': 0,
+    'HASHED_NGRAMS': 1,
+    'NORMALIZE': 2,
+}
+
+
+def pack_string(value):
+    encoded_value = value.encode('utf-8')
+    return struct.pack('<I', len(encoded_value)) + encoded_value
+
+
+def pack_transformations(transformations):
+    packed = bytearray()
+    count = 0
+    for transformation in transformations:
+        transformation_type = transformation['transformation_type']
+        # Unknown transformations are ignored to match |ParsePipelineJSON|
+        if transformation_type not in TRANSFORMATION_TYPES:
+            continue
+
+        packed += struct.pack('<B', TRANSFORMATION_TYPES[transformation_type])
+        if transformation_type == 'HASHED_NGRAMS':
+            params = transformation['params']
+            ngrams_range = params['ngrams_range']
+            packed += struct.pack('<iI', params['num_buckets'],
+                                  len(ngrams_range))
+            packed += struct.pack(f'<{len(ngrams_range)}i', *ngrams_range)
+
+        count += 1
+
+    return struct.pack('<I', count) + packed
+
+
+def pack_classifier(classifier):
+    if classifier['classifier_type'] != 'LINEAR':
+        raise ValueError('Unsupported classifier type')
+
+    classes = classifier['classes']
+    if any(not class_name for class_name in classes):
+        raise ValueError('Empty class name')
+
+    biases = classifier['biases']
+    if len(biases) != len(classes):
+        raise ValueError('Mismatched biases and classes')
+
+    class_weights = {}
+    class_biases = {}
+    for class_name, bias in zip(classes, biases):
+        class_weights[class_name] = [
+            float(weight) for weight in classifier['class_weights'][class_name]
+        ]
+        class_biases[class_name] = float(bias)
+
+    segments = sorted(class_weights, key=lambda name: name.encode('utf-8'))
+    segment_count = len(segments)
+    dimension_counts = [len(class_weights[segment]) for segment in segments]
+    bucket_count = max(dimension_counts, default=0)
+
+    weights = [0.0] * (bucket_count * segment_count)
+    for segment_id, segment in enumerate(segments):
+        for bucket, weight in enumerate(class_weights[segment]):
+            weights[bucket * segment_count + segment_id] = weight
+
+    packed = bytearray(struct.pack('<I', segment_count))
+    for segment in segments:
+        packed += pack_string(segment)
+    packed += struct.pack('<I', bucket_count)
+    packed += struct.pack(f'<{segment_count}i', *dimension_counts)
+    return packed, [class_biases[segment] for segment in segments], weights
+
+
+def convert(pipeline):
+    packed = bytearray(MAGIC)
+    packed += struct.pack('<Ii', FORMAT_VERSION, pipeline['version'])
+    packed += pack_string(pipeline['timestamp'])
+    packed += pack_string(pipeline['locale'])
+    packed += pack_transformations(pipeline['transformations'])
+
+    classifier, biases, weights = pack_classifier(pipeline['classifier'])
+    packed += classifier
+    packed += b'\0' * (-len(packed) % 8)
+    packed += struct.pack(f'<{len(biases)}d', *biases)
+    packed += struct.pack(f'<{len(weights)}d', *weights)
+    return bytes(packed)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Convert a JSON ads pipeline to the binary format')
+    parser.add_argument('--input', required=True,
+                        help='Path to the JSON pipeline')
+    parser.add_argument('--output', required=True,
+                        help='Path to write the binary pipeline to')
+    args = parser.parse_args()
+
+    with open(args.input, 'r', encoding='utf-8') as input_file:
+        pipeline = json.load(input_file)
+
+    with open(args.output, 'wb') as output_file:
+        output_file.write(convert(pipeline))
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())